@@ -607,7 +607,9 @@ constexpr uint64_t kAllTagsForAndBasedTypeChecking[] = {
   /* their entry in the external pointer table but */    \
   /* which are not referenced via a Managed */           \
   V(kArrayBufferExtensionTag,                   TAG(66)) \
-  V(kLastManagedResourceTag,                    TAG(66)) \
+  /* Managed, appended to keep the tags above stable */  \
+  V(kExperimentalRegExpDfaTag,                  TAG(67)) \
+  V(kLastManagedResourceTag,                    TAG(67)) \
 
 // All external pointer tags.
 #define ALL_EXTERNAL_POINTER_TAGS(V) \
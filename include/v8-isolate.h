@@ -195,6 +195,26 @@ enum RAILMode : unsigned {
  */
 enum class MemoryPressureLevel { kNone, kModerate, kCritical };
 
+/**
+ * Garbage collection profiles for Isolate::SetGarbageCollectionProfile.
+ * kDefault uses V8's regular heuristics.
+ * kLowLatency keeps garbage collection pauses short by using small
+ * incremental marking steps and a smaller young generation, at the cost of
+ * more frequent garbage collections.
+ * kThroughput minimizes the overall time spent in garbage collection by
+ * growing the heap and the young generation more eagerly and by using larger
+ * incremental marking steps.
+ * kMemorySaver keeps the heap small by growing it conservatively and by not
+ * growing the young generation, at the cost of more frequent garbage
+ * collections.
+ */
+enum class GarbageCollectionProfile {
+  kDefault,
+  kLowLatency,
+  kThroughput,
+  kMemorySaver
+};
+
 /**
  * Indicator for the stack state.
  */
@@ -718,6 +738,30 @@ class V8_EXPORT Isolate {
    */
   void SetBatterySaverMode(bool battery_saver_mode_enabled);
 
+  /**
+   * Selects the garbage collection profile that tunes the heap growing
+   * strategy, the incremental marking step sizes and the young generation
+   * size of this isolate. Statistics about the garbage collections performed
+   * under each profile are available through
+   * GetGarbageCollectionProfileStatistics, and are printed with
+   * --trace-gc-profile whenever the profile changes. Must be called on the
+   * thread that owns the isolate.
+   */
+  void SetGarbageCollectionProfile(GarbageCollectionProfile profile);
+
+  /**
+   * Get statistics about the garbage collections performed while |profile|
+   * was selected, including the time the current profile has been selected
+   * for so far.
+   *
+   * \param statistics The GarbageCollectionProfileStatistics object to fill
+   *   in.
+   * \returns true on success.
+   */
+  bool GetGarbageCollectionProfileStatistics(
+      GarbageCollectionProfile profile,
+      GarbageCollectionProfileStatistics* statistics);
+
   /**
    * Drop non-essential caches. Should only be called from testing code.
    * The method can potentially block for a long time and does not necessarily
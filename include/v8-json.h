@@ -5,7 +5,13 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
@@ -14,6 +20,10 @@ class Context;
 class Value;
 class String;
 
+namespace internal {
+class JsonChunkBuffer;
+}  // namespace internal
+
 /**
  * A JSON Parser and Stringifier.
  */
@@ -40,6 +50,78 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Receives the output of StringifyToUtf8 in chunks.
+   */
+  class V8_EXPORT Utf8Sink {
+   public:
+    virtual ~Utf8Sink() = default;
+
+    /**
+     * Called with the next |length| bytes of UTF-8 encoded output. |data| is
+     * only valid for the duration of the call.
+     */
+    virtual void Write(const char* data, size_t length) = 0;
+  };
+
+  /**
+   * Like Stringify, but passes the result to |sink| as UTF-8 instead of
+   * creating a string. This avoids allocating the result on the V8 heap and
+   * re-encoding it with String::WriteUtf8. Unpaired surrogates, which are
+   * only emitted verbatim from JSON.rawJSON texts or |gap|, are replaced with
+   * U+FFFD.
+   *
+   * \return Nothing if an exception was thrown, false if |json_object| has no
+   * JSON representation (e.g. it is undefined or a function), in which case
+   * nothing is written to |sink|, and true otherwise.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToUtf8(
+      Local<Context> context, Local<Value> json_object, Utf8Sink* sink,
+      Local<String> gap = Local<String>());
+
+  /**
+   * Collects JSON text that arrives in chunks, e.g. from the network, so that
+   * it can be parsed once it is complete. Chunks are decoded into a single
+   * buffer as they arrive, and that buffer is handed to the parser as an
+   * external string, so the embedder neither has to keep the chunks around
+   * nor concatenate them into a String first.
+   *
+   * This is not an incremental parser: nothing is tokenized or parsed before
+   * Parse() is called, which parses the whole input at once.
+   */
+  class V8_EXPORT ChunkBuffer final {
+   public:
+    enum class Encoding { kOneByte, kUtf8 };
+
+    /**
+     * |expected_length| is the expected number of input bytes, if known
+     * (e.g. from a Content-Length header). It is only used to size the buffer
+     * up front.
+     */
+    explicit ChunkBuffer(Encoding encoding, size_t expected_length = 0);
+    ~ChunkBuffer();
+
+    ChunkBuffer(const ChunkBuffer&) = delete;
+    ChunkBuffer& operator=(const ChunkBuffer&) = delete;
+
+    /**
+     * Appends the next |length| bytes of input. UTF-8 sequences may be split
+     * across chunks. This does not touch the V8 heap and may be called on any
+     * thread, but calls must not be concurrent.
+     */
+    void Append(const uint8_t* data, size_t length);
+
+    /**
+     * Parses all input appended so far in |context| and returns the
+     * corresponding value if successful. Afterwards the buffer is empty and
+     * may be reused for the next input.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(Local<Context> context);
+
+   private:
+    std::unique_ptr<internal::JsonChunkBuffer> impl_;
+  };
 };
 
 }  // namespace v8
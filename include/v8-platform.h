@@ -548,6 +548,16 @@ class PageAllocator {
    */
   virtual bool DiscardSystemPages(void* address, size_t size) { return true; }
 
+  /**
+   * Advises the OS to back the given [address, address + size) range with
+   * huge pages once its pages are committed. This is only a hint, which V8
+   * gives for reservations whose pages are freed by making them inaccessible.
+   *
+   * \returns true if the advice was given, false otherwise. The default
+   * implementation gives no advice.
+   */
+  virtual bool AdviseHugePages(void* address, size_t size) { return false; }
+
   /**
    * Decommits any wired memory pages in the given range, allowing the OS to
    * reclaim them, and marks the region as inacessible (kNoAccess). The address
@@ -1016,6 +1026,15 @@ class VirtualAddressSpace {
                                                         size_t size) {
     return true;
   }
+
+  /**
+   * Advises the OS to back the given [address, address + size) range with
+   * huge pages once its pages are committed. This is only a hint.
+   *
+   * \returns true if the advice was given, false otherwise. The default
+   * implementation gives no advice.
+   */
+  virtual bool AdviseHugePages(Address address, size_t size) { return false; }
   /**
    * Decommits any wired memory pages in the given range, allowing the OS to
    * reclaim them, and marks the region as inacessible (kNoAccess). The address
@@ -233,6 +233,31 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Statistics about the garbage collections performed while a
+ * GarbageCollectionProfile was selected.
+ */
+class V8_EXPORT GarbageCollectionProfileStatistics {
+ public:
+  GarbageCollectionProfileStatistics();
+  double active_time_ms() { return active_time_ms_; }
+  size_t young_gc_count() { return young_gc_count_; }
+  size_t full_gc_count() { return full_gc_count_; }
+  double total_pause_ms() { return total_pause_ms_; }
+  double max_pause_ms() { return max_pause_ms_; }
+  double incremental_marking_ms() { return incremental_marking_ms_; }
+
+ private:
+  double active_time_ms_;
+  size_t young_gc_count_;
+  size_t full_gc_count_;
+  double total_pause_ms_;
+  double max_pause_ms_;
+  double incremental_marking_ms_;
+
+  friend class Isolate;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_STATISTICS_H_
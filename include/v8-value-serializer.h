@@ -18,6 +18,7 @@
 namespace v8 {
 
 class ArrayBuffer;
+class BackingStore;
 class Isolate;
 class Object;
 class SharedArrayBuffer;
@@ -112,6 +113,20 @@ class V8_EXPORT ValueSerializer {
     virtual Maybe<uint32_t> GetWasmModuleTransferId(
         Isolate* isolate, Local<WasmModuleObject> module);
 
+    /**
+     * Called when the ValueSerializer is going to write the contents of an
+     * ArrayBuffer out of band (see
+     * ValueSerializer::SetArrayBufferBlobThreshold). The embedder must keep
+     * |backing_store| alive until the serialized data has been deserialized,
+     * and return an ID for it. When deserializing, this ID will be passed to
+     * ValueDeserializer::Delegate::GetArrayBufferBlobFromId as |blob_id|.
+     *
+     * If the object cannot be serialized, an
+     * exception should be thrown and Nothing<uint32_t>() returned.
+     */
+    virtual Maybe<uint32_t> GetArrayBufferBlobId(
+        Isolate* isolate, std::shared_ptr<BackingStore> backing_store);
+
     /**
      * Called when the first shared value is serialized. All subsequent shared
      * values will use the same conveyor.
@@ -190,6 +205,36 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  enum class ArrayBufferBlobMode {
+    /**
+     * The blob is a new backing store holding a copy of the buffer contents.
+     */
+    kCopy,
+    /**
+     * The blob is the backing store of the buffer itself, and the buffer is
+     * detached once WriteValue succeeds, as if it had been transferred.
+     * Delegate::GetArrayBufferBlobId is called for these buffers only after
+     * the whole value has been written. Buffers which cannot be detached are
+     * copied instead. If GetArrayBufferBlobId fails for one of the buffers,
+     * the buffers already handed to it are detached nonetheless.
+     */
+    kMove,
+  };
+
+  /**
+   * Indicate that the contents of ArrayBuffers of at least |min_byte_length|
+   * bytes should not be copied into the serialized data, but handed to
+   * Delegate::GetArrayBufferBlobId as a backing store. The deserializer wraps
+   * the backing store returned by
+   * ValueDeserializer::Delegate::GetArrayBufferBlobFromId without copying it.
+   * Resizable ArrayBuffers are always written inline. This should not be
+   * called when no Delegate was passed.
+   *
+   * The default is to write all ArrayBuffers inline.
+   */
+  void SetArrayBufferBlobThreshold(size_t min_byte_length,
+                                   ArrayBufferBlobMode mode);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
@@ -239,6 +284,15 @@ class V8_EXPORT ValueDeserializer {
     virtual MaybeLocal<SharedArrayBuffer> GetSharedArrayBufferFromId(
         Isolate* isolate, uint32_t clone_id);
 
+    /**
+     * Get the backing store of an ArrayBuffer given a blob_id previously
+     * provided by ValueSerializer::Delegate::GetArrayBufferBlobId. If the
+     * backing store is not available, an exception should be thrown and
+     * nullptr returned.
+     */
+    virtual std::shared_ptr<BackingStore> GetArrayBufferBlobFromId(
+        Isolate* isolate, uint32_t blob_id);
+
     /**
      * Get the SharedValueConveyor previously provided by
      * ValueSerializer::Delegate::AdoptSharedValueConveyor.
@@ -65,6 +65,7 @@
 #include "src/handles/persistent-handles.h"
 #include "src/handles/shared-object-conveyor-handles.h"
 #include "src/handles/traced-handles-inl.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier.h"
 #include "src/heap/safepoint.h"
@@ -73,6 +74,7 @@
 #include "src/init/startup-data-util.h"
 #include "src/init/v8.h"
 #include "src/json/json-parser.h"
+#include "src/json/json-chunk-buffer.h"
 #include "src/json/json-stringifier.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/metrics.h"
@@ -3383,6 +3385,48 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyToUtf8(Local<Context> context,
+                                  Local<Value> json_object, Utf8Sink* sink,
+                                  Local<String> gap) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(i_isolate, context, JSON, Stringify, i::HandleScope);
+  auto object = Utils::OpenHandle(*json_object);
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? i_isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  Maybe<bool> result =
+      i::JsonStringifyToUtf8(i_isolate, object, gap_string, sink);
+  has_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
+JSON::ChunkBuffer::ChunkBuffer(Encoding encoding, size_t expected_length)
+    : impl_(std::make_unique<i::JsonChunkBuffer>(
+          encoding == Encoding::kUtf8, expected_length)) {}
+
+JSON::ChunkBuffer::~ChunkBuffer() = default;
+
+void JSON::ChunkBuffer::Append(const uint8_t* data, size_t length) {
+  impl_->Append(data, length);
+}
+
+MaybeLocal<Value> JSON::ChunkBuffer::Parse(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, JSON, Parse);
+  i::Handle<i::String> source;
+  has_exception = !impl_->Finish(i_isolate).ToHandle(&source);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  i::Handle<i::Object> undefined = i_isolate->factory()->undefined_value();
+  auto maybe =
+      source->IsOneByteRepresentation()
+          ? i::JsonParser<uint8_t>::Parse(i_isolate, source, undefined)
+          : i::JsonParser<uint16_t>::Parse(i_isolate, source, undefined);
+  Local<Value> result;
+  has_exception = !ToLocal<Value>(maybe, &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -3436,6 +3480,15 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetWasmModuleTransferId(
   return Nothing<uint32_t>();
 }
 
+Maybe<uint32_t> ValueSerializer::Delegate::GetArrayBufferBlobId(
+    Isolate* v8_isolate, std::shared_ptr<BackingStore> backing_store) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i_isolate->Throw(*i_isolate->factory()->NewError(
+      i_isolate->error_function(), i::MessageTemplate::kDataCloneError,
+      i_isolate->factory()->NewStringFromAsciiChecked("ArrayBuffer")));
+  return Nothing<uint32_t>();
+}
+
 bool ValueSerializer::Delegate::AdoptSharedValueConveyor(
     Isolate* v8_isolate, SharedValueConveyor&& conveyor) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -3478,12 +3531,18 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetArrayBufferBlobThreshold(size_t min_byte_length,
+                                                  ArrayBufferBlobMode mode) {
+  private_->serializer.SetArrayBufferBlobThreshold(min_byte_length, mode);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
   ENTER_V8(i_isolate, context, ValueSerializer, WriteValue, i::HandleScope);
   auto object = Utils::OpenHandle(*value);
   Maybe<bool> result = private_->serializer.WriteObject(object);
+  result = private_->serializer.FinishMovedArrayBuffers(result.IsJust());
   has_exception = result.IsNothing();
   RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
   return result;
@@ -3543,6 +3602,16 @@ ValueDeserializer::Delegate::GetSharedArrayBufferFromId(Isolate* v8_isolate,
   return MaybeLocal<SharedArrayBuffer>();
 }
 
+std::shared_ptr<BackingStore>
+ValueDeserializer::Delegate::GetArrayBufferBlobFromId(Isolate* v8_isolate,
+                                                      uint32_t blob_id) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i_isolate->Throw(*i_isolate->factory()->NewError(
+      i_isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return nullptr;
+}
+
 const SharedValueConveyor* ValueDeserializer::Delegate::GetSharedValueConveyor(
     Isolate* v8_isolate) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -6614,6 +6683,14 @@ HeapCodeStatistics::HeapCodeStatistics()
       external_script_source_size_(0),
       cpu_profiler_metadata_size_(0) {}
 
+GarbageCollectionProfileStatistics::GarbageCollectionProfileStatistics()
+    : active_time_ms_(0),
+      young_gc_count_(0),
+      full_gc_count_(0),
+      total_pause_ms_(0),
+      max_pause_ms_(0),
+      incremental_marking_ms_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -10491,6 +10568,33 @@ void Isolate::SetBatterySaverMode(bool battery_saver_mode_enabled) {
   i_isolate->set_battery_saver_mode_enabled(battery_saver_mode_enabled);
 }
 
+void Isolate::SetGarbageCollectionProfile(GarbageCollectionProfile profile) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->SetGarbageCollectionProfile(profile);
+}
+
+bool Isolate::GetGarbageCollectionProfileStatistics(
+    GarbageCollectionProfile profile,
+    GarbageCollectionProfileStatistics* statistics) {
+  if (!statistics) return false;
+
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  const i::GCTracer::GCProfileStatistics profile_statistics =
+      i_isolate->heap()->tracer()->GetGCProfileStatistics(profile);
+
+  statistics->active_time_ms_ =
+      profile_statistics.active_time.InMillisecondsF();
+  statistics->young_gc_count_ = profile_statistics.young_gcs;
+  statistics->full_gc_count_ = profile_statistics.full_gcs;
+  statistics->total_pause_ms_ =
+      profile_statistics.total_pause.InMillisecondsF();
+  statistics->max_pause_ms_ = profile_statistics.max_pause.InMillisecondsF();
+  statistics->incremental_marking_ms_ =
+      profile_statistics.incremental_marking.InMillisecondsF();
+
+  return true;
+}
+
 void Isolate::ClearCachesForTesting() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->AbortConcurrentOptimization(i::BlockingBehavior::kBlock);
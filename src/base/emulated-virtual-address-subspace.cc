@@ -205,5 +205,11 @@ bool EmulatedVirtualAddressSubspace::DecommitPages(Address address,
   return parent_space_->DecommitPages(address, size);
 }
 
+bool EmulatedVirtualAddressSubspace::AdviseHugePages(Address address,
+                                                     size_t size) {
+  DCHECK(Contains(address, size));
+  return parent_space_->AdviseHugePages(address, size);
+}
+
 }  // namespace base
 }  // namespace v8
@@ -82,6 +82,8 @@ class V8_BASE_EXPORT EmulatedVirtualAddressSubspace final
 
   bool DecommitPages(Address address, size_t size) override;
 
+  bool AdviseHugePages(Address address, size_t size) override;
+
  private:
   size_t mapped_size() const { return mapped_size_; }
   size_t unmapped_size() const { return size() - mapped_size_; }
@@ -174,5 +174,9 @@ bool PageAllocator::DecommitPages(void* address, size_t size) {
   return base::OS::DecommitPages(address, size);
 }
 
+bool PageAllocator::AdviseHugePages(void* address, size_t size) {
+  return base::OS::AdviseHugePages(address, size);
+}
+
 }  // namespace base
 }  // namespace v8
@@ -760,6 +760,24 @@ bool OS::HasLazyCommits() {
 #endif  // !V8_OS_ZOS
 #endif  // !V8_OS_CYGWIN && !V8_OS_FUCHSIA
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  constexpr uintptr_t kTransparentHugePageSize = uintptr_t{2} * 1024 * 1024;
+  const uintptr_t huge_start =
+      RoundUp(reinterpret_cast<uintptr_t>(address), kTransparentHugePageSize);
+  const uintptr_t huge_end = RoundDown(
+      reinterpret_cast<uintptr_t>(address) + size, kTransparentHugePageSize);
+  if (huge_end <= huge_start) return false;
+  // The advice sticks to the mapping across later permission changes, so
+  // reservations only need to be advised once.
+  return madvise(reinterpret_cast<void*>(huge_start), huge_end - huge_start,
+                 MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif  // V8_OS_LINUX && defined(MADV_HUGEPAGE)
+}
+
 const char* OS::GetGCFakeMMapFile() {
   return g_gc_fake_mmap;
 }
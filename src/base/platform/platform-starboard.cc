@@ -487,6 +487,12 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return true;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Starboard API does not support this function yet.
+  return false;
+}
+
 // static
 Stack::StackSlot Stack::GetStackStart() {
   SB_NOTIMPLEMENTED();
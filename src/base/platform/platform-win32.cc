@@ -1120,6 +1120,12 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ptr;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Large pages on Windows have to be allocated as such up front.
+  return false;
+}
+
 // static
 bool OS::DecommitPages(void* address, size_t size) {
   DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % CommitPageSize());
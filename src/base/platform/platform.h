@@ -406,6 +406,11 @@ class V8_BASE_EXPORT OS {
 
   V8_WARN_UNUSED_RESULT static bool DecommitPages(void* address, size_t size);
 
+  // Advises the OS to back the 2MB aligned parts of the given range with
+  // transparent huge pages once they are committed. Returns false if this is
+  // not supported, in which case the range is left untouched.
+  static bool AdviseHugePages(void* address, size_t size);
+
   V8_WARN_UNUSED_RESULT static bool CanReserveAddressSpace();
 
   V8_WARN_UNUSED_RESULT static Optional<AddressSpaceReservation>
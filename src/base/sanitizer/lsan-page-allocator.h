@@ -72,6 +72,10 @@ class V8_BASE_EXPORT LsanPageAllocator : public v8::PageAllocator {
     return page_allocator_->DecommitPages(address, size);
   }
 
+  bool AdviseHugePages(void* address, size_t size) override {
+    return page_allocator_->AdviseHugePages(address, size);
+  }
+
  private:
   v8::PageAllocator* const page_allocator_;
   const size_t allocate_page_size_;
@@ -79,6 +79,10 @@ class V8_BASE_EXPORT LsanVirtualAddressSpace final
     return vas_->DecommitPages(address, size);
   }
 
+  bool AdviseHugePages(Address address, size_t size) override {
+    return vas_->AdviseHugePages(address, size);
+  }
+
  private:
   std::unique_ptr<v8::VirtualAddressSpace> vas_;
 };
@@ -83,5 +83,10 @@ bool VirtualAddressSpacePageAllocator::DecommitPages(void* address,
   return vas_->DecommitPages(reinterpret_cast<Address>(address), size);
 }
 
+bool VirtualAddressSpacePageAllocator::AdviseHugePages(void* address,
+                                                       size_t size) {
+  return vas_->AdviseHugePages(reinterpret_cast<Address>(address), size);
+}
+
 }  // namespace base
 }  // namespace v8
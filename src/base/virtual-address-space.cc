@@ -198,6 +198,13 @@ bool VirtualAddressSpace::DecommitPages(Address address, size_t size) {
   return OS::DecommitPages(reinterpret_cast<void*>(address), size);
 }
 
+bool VirtualAddressSpace::AdviseHugePages(Address address, size_t size) {
+  DCHECK(IsAligned(address, page_size()));
+  DCHECK(IsAligned(size, page_size()));
+
+  return OS::AdviseHugePages(reinterpret_cast<void*>(address), size);
+}
+
 void VirtualAddressSpace::FreeSubspace(VirtualAddressSubspace* subspace) {
   OS::FreeAddressSpaceReservation(subspace->reservation_);
 }
@@ -417,6 +424,16 @@ bool VirtualAddressSubspace::DecommitPages(Address address, size_t size) {
   return reservation_.DecommitPages(reinterpret_cast<void*>(address), size);
 }
 
+bool VirtualAddressSubspace::AdviseHugePages(Address address, size_t size) {
+  DCHECK(IsAligned(address, page_size()));
+  DCHECK(IsAligned(size, page_size()));
+  DCHECK(reservation_.Contains(reinterpret_cast<void*>(address), size));
+
+  // The advice does not change the mapping, so the reservation can give it
+  // directly.
+  return OS::AdviseHugePages(reinterpret_cast<void*>(address), size);
+}
+
 void VirtualAddressSubspace::FreeSubspace(VirtualAddressSubspace* subspace) {
   MutexGuard guard(&mutex_);
 
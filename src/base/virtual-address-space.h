@@ -93,6 +93,8 @@ class V8_BASE_EXPORT VirtualAddressSpace : public VirtualAddressSpaceBase {
 
   bool DecommitPages(Address address, size_t size) override;
 
+  bool AdviseHugePages(Address address, size_t size) override;
+
  private:
   void FreeSubspace(VirtualAddressSubspace* subspace) override;
 };
@@ -146,6 +148,8 @@ class V8_BASE_EXPORT VirtualAddressSubspace : public VirtualAddressSpaceBase {
 
   bool DecommitPages(Address address, size_t size) override;
 
+  bool AdviseHugePages(Address address, size_t size) override;
+
  private:
   // The VirtualAddressSpace class creates instances of this class when
   // allocating sub spaces.
@@ -6074,8 +6074,14 @@ TNode<FixedArrayBase> CodeStubAssembler::GrowElementsCapacity(
   CSA_SLOW_DCHECK(this, IsFixedArrayWithKindOrEmpty(elements, from_kind));
 
   // If size of the allocation for the new capacity doesn't fit in a page
-  // that we can bump-pointer allocate from, fall back to the runtime.
-  int max_size = FixedArrayBase::GetMaxLengthForNewSpaceAllocation(to_kind);
+  // that we can bump-pointer allocate from, fall back to the runtime. Large
+  // backing stores are grown by the runtime as well, which collects
+  // pretenuring feedback for them.
+  int max_size = std::min(
+      FixedArrayBase::GetMaxLengthForNewSpaceAllocation(to_kind),
+      (PretenuringHandler::kMinRuntimeAllocationSiteObjectSize -
+       FixedArrayBase::kHeaderSize) >>
+          ElementsKindToShiftSize(to_kind));
   GotoIf(UintPtrOrSmiGreaterThanOrEqual(new_capacity,
                                         IntPtrOrSmiConstant<TIndex>(max_size)),
          bailout);
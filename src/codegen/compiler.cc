@@ -1116,6 +1116,22 @@ bool CompileTurbofan_Concurrent(Isolate* isolate,
   DCHECK_EQ(compilation_info->code_kind(), CodeKind::TURBOFAN);
   DirectHandle<JSFunction> function = compilation_info->closure();
 
+  // A job for the function may still be waiting from a request that was
+  // withdrawn by a deopt. It has not read any feedback yet, so it serves the
+  // new request just as well.
+  if (!compilation_info->is_osr() &&
+      !compilation_info->discard_result_for_testing() &&
+      isolate->optimizing_compile_dispatcher()->HasQueuedJob(*function)) {
+    if (v8_flags.trace_concurrent_recompilation) {
+      PrintF("  ** Merged request to optimize ");
+      ShortPrint(*function);
+      PrintF(" into its queued job.\n");
+    }
+    SetTieringState(isolate, *function, compilation_info->osr_offset(),
+                    TieringState::kInProgress);
+    return true;
+  }
+
   if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
     if (v8_flags.trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -84,7 +86,24 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
 
 TurbofanCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
-  return input_queue_.Dequeue();
+  base::TimeDelta wait_time;
+  TurbofanCompilationJob* job = input_queue_.Dequeue(&wait_time);
+  if (!job) return nullptr;
+  isolate_->counters()->turbofan_optimize_queue_wait_time()->AddTimedSample(
+      wait_time);
+  base::MutexGuard access_output_queue_(&output_queue_mutex_);
+  started_jobs_.emplace_back(job, false);
+  return job;
+}
+
+bool OptimizingCompileDispatcher::TakeStartedJob(TurbofanCompilationJob* job) {
+  base::MutexGuard access_output_queue_(&output_queue_mutex_);
+  auto it = std::find_if(started_jobs_.begin(), started_jobs_.end(),
+                         [=](const auto& entry) { return entry.first == job; });
+  CHECK(it != started_jobs_.end());
+  bool stale = it->second;
+  started_jobs_.erase(it);
+  return stale;
 }
 
 void OptimizingCompileDispatcher::CompileNext(TurbofanCompilationJob* job,
@@ -116,19 +135,48 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
       job.reset(output_queue_.front());
       output_queue_.pop();
     }
+    TakeStartedJob(job.get());
 
     Compiler::DisposeTurbofanCompilationJob(isolate_, job.get(),
                                             restore_function_code);
   }
 }
 
+TurbofanCompilationJob* OptimizingCompileDispatcherQueue::Remove(int i) {
+  DCHECK_LE(0, i);
+  DCHECK_LT(i, length_);
+  TurbofanCompilationJob* job = queue_[i].job;
+  DCHECK_NOT_NULL(job);
+  std::copy(queue_ + i + 1, queue_ + length_, queue_ + i);
+  length_--;
+  return job;
+}
+
+TurbofanCompilationJob* OptimizingCompileDispatcherQueue::Dequeue(
+    base::TimeDelta* wait_time) {
+  base::MutexGuard access(&mutex_);
+  if (length_ == 0) return nullptr;
+  // The entries are in FIFO order, so the first one with the most ticks wins.
+  int next = 0;
+  for (int i = 1; i < length_; ++i) {
+    if (queue_[i].ticks > queue_[next].ticks) next = i;
+  }
+  if (wait_time) {
+    *wait_time = base::TimeTicks::Now() - queue_[next].enqueue_time;
+  }
+  return Remove(next);
+}
+
+void OptimizingCompileDispatcherQueue::Enqueue(TurbofanCompilationJob* job) {
+  base::MutexGuard access(&mutex_);
+  DCHECK_LT(length_, capacity_);
+  queue_[length_++] = {job, base::TimeTicks::Now(), 0};
+}
+
 void OptimizingCompileDispatcherQueue::Flush(Isolate* isolate) {
   base::MutexGuard access(&mutex_);
   while (length_ > 0) {
-    std::unique_ptr<TurbofanCompilationJob> job(queue_[QueueIndex(0)]);
-    DCHECK_NOT_NULL(job);
-    shift_ = QueueIndex(1);
-    length_--;
+    std::unique_ptr<TurbofanCompilationJob> job(Remove(0));
     Compiler::DisposeTurbofanCompilationJob(isolate, job.get(), true);
   }
 }
@@ -188,6 +236,7 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
       job.reset(output_queue_.front());
       output_queue_.pop();
     }
+    bool stale = TakeStartedJob(job.get());
     OptimizedCompilationInfo* info = job->compilation_info();
     DirectHandle<JSFunction> function(*info->closure(), isolate_);
 
@@ -200,10 +249,25 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
         ShortPrint(*function);
         PrintF(" as it has already been optimized.\n");
       }
+      isolate_->counters()->turbofan_optimize_jobs_discarded()->Increment();
       Compiler::DisposeTurbofanCompilationJob(isolate_, job.get(), false);
       continue;
     }
 
+    // The function deoptimized while the job was running, so the result would
+    // likely deoptimize for the same reason. The deoptimizer has already reset
+    // the tiering state, which may belong to a newer request by now, so the
+    // job is dropped without touching the function.
+    if (stale) {
+      if (v8_flags.trace_concurrent_recompilation) {
+        PrintF("  ** Aborting compilation for ");
+        ShortPrint(*function);
+        PrintF(" as it has deoptimized in the meantime.\n");
+      }
+      isolate_->counters()->turbofan_optimize_jobs_discarded()->Increment();
+      continue;
+    }
+
     Compiler::FinalizeTurbofanCompilationJob(job.get(), isolate_);
   }
 }
@@ -217,6 +281,8 @@ void OptimizingCompileDispatcher::QueueForOptimization(
     TurbofanCompilationJob* job) {
   DCHECK(input_queue_.IsAvailable());
   input_queue_.Enqueue(job);
+  isolate_->counters()->turbofan_optimize_queue_length()->AddSample(
+      input_queue_.Length());
   if (job_handle_->UpdatePriorityEnabled()) {
     job_handle_->UpdatePriority(isolate_->EfficiencyModeEnabledForTiering()
                                     ? kEfficiencyTaskPriority
@@ -228,22 +294,41 @@ void OptimizingCompileDispatcher::QueueForOptimization(
 void OptimizingCompileDispatcherQueue::Prioritize(
     Tagged<SharedFunctionInfo> function) {
   base::MutexGuard access(&mutex_);
-  if (length_ > 1) {
-    for (int i = length_ - 1; i > 1; --i) {
-      if (*queue_[QueueIndex(i)]->compilation_info()->shared_info() ==
-          function) {
-        std::swap(queue_[QueueIndex(i)], queue_[QueueIndex(0)]);
-        return;
-      }
+  for (int i = 0; i < length_; ++i) {
+    if (*queue_[i].job->compilation_info()->shared_info() == function) {
+      queue_[i].ticks++;
     }
   }
 }
 
+bool OptimizingCompileDispatcherQueue::Contains(Tagged<JSFunction> function) {
+  base::MutexGuard access(&mutex_);
+  for (int i = 0; i < length_; ++i) {
+    OptimizedCompilationInfo* info = queue_[i].job->compilation_info();
+    if (!info->is_osr() && *info->closure() == function) return true;
+  }
+  return false;
+}
+
 void OptimizingCompileDispatcher::Prioritize(
     Tagged<SharedFunctionInfo> function) {
   input_queue_.Prioritize(function);
 }
 
+bool OptimizingCompileDispatcher::HasQueuedJob(Tagged<JSFunction> function) {
+  return input_queue_.Contains(function);
+}
+
+void OptimizingCompileDispatcher::DiscardStartedJobs(
+    Tagged<JSFunction> function) {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  base::MutexGuard access_output_queue_(&output_queue_mutex_);
+  for (auto& [job, stale] : started_jobs_) {
+    OptimizedCompilationInfo* info = job->compilation_info();
+    if (!info->is_osr() && *info->closure() == function) stale = true;
+  }
+}
+
 OptimizingCompileDispatcher::OptimizingCompileDispatcher(Isolate* isolate)
     : isolate_(isolate),
       input_queue_(v8_flags.concurrent_recompilation_queue_length),
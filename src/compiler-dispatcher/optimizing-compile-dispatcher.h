@@ -7,9 +7,12 @@
 
 #include <atomic>
 #include <queue>
+#include <utility>
+#include <vector>
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/heap/parked-scope.h"
@@ -18,12 +21,16 @@
 namespace v8 {
 namespace internal {
 
+class JSFunction;
 class LocalHeap;
 class TurbofanCompilationJob;
 class RuntimeCallStats;
 class SharedFunctionInfo;
 
-// Circular queue of incoming recompilation tasks (including OSR).
+// Queue of incoming recompilation tasks (including OSR). Jobs are not taken
+// out in FIFO order: every entry counts the interrupt budget exhaustions of
+// its function while it waits, and the job with the most of them is compiled
+// next. Jobs with the same count are taken out in FIFO order.
 class V8_EXPORT OptimizingCompileDispatcherQueue {
  public:
   inline bool IsAvailable() {
@@ -37,45 +44,39 @@ class V8_EXPORT OptimizingCompileDispatcherQueue {
   }
 
   explicit OptimizingCompileDispatcherQueue(int capacity)
-      : capacity_(capacity), length_(0), shift_(0) {
-    queue_ = NewArray<TurbofanCompilationJob*>(capacity_);
+      : capacity_(capacity), length_(0) {
+    queue_ = NewArray<Entry>(capacity_);
   }
 
   ~OptimizingCompileDispatcherQueue() { DeleteArray(queue_); }
 
-  TurbofanCompilationJob* Dequeue() {
-    base::MutexGuard access(&mutex_);
-    if (length_ == 0) return nullptr;
-    TurbofanCompilationJob* job = queue_[QueueIndex(0)];
-    DCHECK_NOT_NULL(job);
-    shift_ = QueueIndex(1);
-    length_--;
-    return job;
-  }
+  // Returns nullptr if the queue is empty. Otherwise, stores how long the job
+  // waited in the queue in |wait_time| if it is given.
+  TurbofanCompilationJob* Dequeue(base::TimeDelta* wait_time = nullptr);
 
-  void Enqueue(TurbofanCompilationJob* job) {
-    base::MutexGuard access(&mutex_);
-    DCHECK_LT(length_, capacity_);
-    queue_[QueueIndex(length_)] = job;
-    length_++;
-  }
+  void Enqueue(TurbofanCompilationJob* job);
 
   void Flush(Isolate* isolate);
 
+  // Bumps the priority of the jobs for |function|.
   void Prioritize(Tagged<SharedFunctionInfo> function);
 
+  // Whether a job that is not for OSR is waiting for |function|.
+  bool Contains(Tagged<JSFunction> function);
+
  private:
-  inline int QueueIndex(int i) {
-    int result = (i + shift_) % capacity_;
-    DCHECK_LE(0, result);
-    DCHECK_LT(result, capacity_);
-    return result;
-  }
+  struct Entry {
+    TurbofanCompilationJob* job;
+    base::TimeTicks enqueue_time;
+    int ticks;
+  };
+
+  // Removes the entry at index |i| and keeps the order of the others.
+  TurbofanCompilationJob* Remove(int i);
 
-  TurbofanCompilationJob** queue_;
+  Entry* queue_;
   int capacity_;
   int length_;
-  int shift_;
   base::Mutex mutex_;
 };
 
@@ -110,6 +111,17 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   void Prioritize(Tagged<SharedFunctionInfo> function);
 
+  // Whether a job for |function| that is not for OSR is waiting in the input
+  // queue. Such a job reads the feedback of the function only once it starts,
+  // so a new request for the function can be merged into it.
+  bool HasQueuedJob(Tagged<JSFunction> function);
+
+  // Called when |function| deoptimized and its tiering state was reset. The
+  // results of jobs for it that have already started were computed from the
+  // feedback that led to the deopt, so they are discarded instead of being
+  // installed. Jobs that wait in the input queue are kept.
+  void DiscardStartedJobs(Tagged<JSFunction> function);
+
  private:
   class CompileTask;
 
@@ -124,6 +136,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(TurbofanCompilationJob* job, LocalIsolate* local_isolate);
   TurbofanCompilationJob* NextInput(LocalIsolate* local_isolate);
+  // Forgets about a job that left the output queue and returns whether its
+  // result is stale.
+  bool TakeStartedJob(TurbofanCompilationJob* job);
 
   Isolate* isolate_;
 
@@ -135,6 +150,10 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // different threads.
   base::Mutex output_queue_mutex_;
 
+  // Jobs that have left the input queue but are not installed yet, along with
+  // whether their results are stale. Guarded by output_queue_mutex_.
+  std::vector<std::pair<TurbofanCompilationJob*, bool>> started_jobs_;
+
   std::unique_ptr<JobHandle> job_handle_;
 
   // Copy of v8_flags.concurrent_recompilation_delay that will be used from the
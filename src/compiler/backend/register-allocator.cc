@@ -1192,8 +1192,6 @@ RegisterAllocationData::RegisterAllocationData(
       assigned_double_registers_(nullptr),
       virtual_register_count_(code->VirtualRegisterCount()),
       preassigned_slot_ranges_(zone),
-      spill_state_(code->InstructionBlockCount(), ZoneVector<LiveRange*>(zone),
-                   zone),
       tick_counter_(tick_counter),
       slot_for_const_range_(zone) {
   if (kFPAliasing == AliasingKind::kCombine) {
@@ -1340,13 +1338,13 @@ bool RegisterAllocationData::RangesDefinedInDeferredStayInDeferred() {
 }
 
 SpillRange* RegisterAllocationData::AssignSpillRangeToLiveRange(
-    TopLevelLiveRange* range, SpillMode spill_mode) {
+    TopLevelLiveRange* range, SpillMode spill_mode, Zone* zone) {
   using SpillType = TopLevelLiveRange::SpillType;
   DCHECK(!range->HasSpillOperand());
 
   SpillRange* spill_range = range->GetAllocatedSpillRange();
   if (spill_range == nullptr) {
-    spill_range = allocation_zone()->New<SpillRange>(range, allocation_zone());
+    spill_range = zone->New<SpillRange>(range, zone);
   }
   if (spill_mode == SpillMode::kSpillDeferred &&
       (range->spill_type() != SpillType::kSpillRange)) {
@@ -2403,7 +2401,8 @@ void LiveRangeBuilder::BuildLiveRanges() {
                   TopLevelLiveRange::SlotUseKind::kDeferredSlotUse
               ? SpillMode::kSpillDeferred
               : SpillMode::kSpillAtDefinition;
-      data()->AssignSpillRangeToLiveRange(range, spill_mode);
+      data()->AssignSpillRangeToLiveRange(range, spill_mode,
+                                          allocation_zone());
     }
     // TODO(bmeurer): This is a horrible hack to make sure that for constant
     // live ranges, every use requires the constant to be in a register.
@@ -2431,7 +2430,8 @@ void LiveRangeBuilder::BuildLiveRanges() {
     SpillRange* spill = range->HasSpillRange()
                             ? range->GetSpillRange()
                             : data()->AssignSpillRangeToLiveRange(
-                                  range, SpillMode::kSpillAtDefinition);
+                                  range, SpillMode::kSpillAtDefinition,
+                                  allocation_zone());
     spill->set_assigned_slot(slot_id);
   }
 #ifdef DEBUG
@@ -2692,7 +2692,9 @@ RegisterAllocator::RegisterAllocator(RegisterAllocationData* data,
           GetAllocatableRegisterCount(data->config(), kind)),
       allocatable_register_codes_(
           GetAllocatableRegisterCodes(data->config(), kind)),
-      check_fp_aliasing_(false) {
+      check_fp_aliasing_(false),
+      allocation_zone_(data->allocation_zone()),
+      tick_counter_(data->tick_counter()) {
   if (kFPAliasing == AliasingKind::kCombine && kind == RegisterKind::kDouble) {
     check_fp_aliasing_ = (data->code()->representation_mask() &
                           (kFloat32Bit | kSimd128Bit)) != 0;
@@ -2885,7 +2887,7 @@ void RegisterAllocator::Spill(LiveRange* range, SpillMode spill_mode) {
   TRACE("Starting spill type is %d\n", static_cast<int>(first->spill_type()));
   if (first->HasNoSpillType()) {
     TRACE("New spill range needed\n");
-    data()->AssignSpillRangeToLiveRange(first, spill_mode);
+    data()->AssignSpillRangeToLiveRange(first, spill_mode, allocation_zone());
   }
   // Upgrade the spillmode, in case this was only spilled in deferred code so
   // far.
@@ -2919,7 +2921,9 @@ LinearScanAllocator::LinearScanAllocator(RegisterAllocationData* data,
       inactive_live_ranges_(num_registers(), InactiveLiveRangeQueue(local_zone),
                             local_zone),
       next_active_ranges_change_(LifetimePosition::Invalid()),
-      next_inactive_ranges_change_(LifetimePosition::Invalid()) {
+      next_inactive_ranges_change_(LifetimePosition::Invalid()),
+      spill_state_(data->code()->InstructionBlockCount(),
+                   ZoneVector<LiveRange*>(local_zone), local_zone) {
   active_live_ranges().reserve(8);
 }
 
@@ -3167,8 +3171,8 @@ RpoNumber LinearScanAllocator::ChooseOneOfTwoPredecessorStates(
   // We count uses only for live ranges that are unique to either the left or
   // the right predecessor since many live ranges are shared between both.
   // Shared ranges don't influence the decision anyway and this is faster.
-  auto& left = data()->GetSpillState(current_block->predecessors()[0]);
-  auto& right = data()->GetSpillState(current_block->predecessors()[1]);
+  auto& left = GetSpillState(current_block->predecessors()[0]);
+  auto& right = GetSpillState(current_block->predecessors()[1]);
 
   // Build a set of the `TopLevelLiveRange`s in the left predecessor.
   // Usually this set is very small, e.g., for JetStream2 at most 3 ranges in
@@ -3277,7 +3281,7 @@ void LinearScanAllocator::ComputeStateFromManyPredecessors(
   // We don't want too many inline elements though since `Vote` is pretty large.
   using RangeVoteMap = SmallZoneMap<TopLevelLiveRange*, Vote, 16>;
   static_assert(sizeof(RangeVoteMap) < 4096, "too large stack allocation");
-  RangeVoteMap counts(data()->allocation_zone());
+  RangeVoteMap counts(allocation_zone());
 
   int deferred_blocks = 0;
   for (RpoNumber pred : current_block->predecessors()) {
@@ -3286,7 +3290,7 @@ void LinearScanAllocator::ComputeStateFromManyPredecessors(
       deferred_blocks++;
       continue;
     }
-    const auto& pred_state = data()->GetSpillState(pred);
+    const auto& pred_state = GetSpillState(pred);
     for (LiveRange* range : pred_state) {
       // We might have spilled the register backwards, so the range we
       // stored might have lost its register. Ignore those.
@@ -3413,7 +3417,7 @@ void LinearScanAllocator::UpdateDeferredFixedRanges(SpillMode spill_mode,
               other->TopLevel()->vreg(),
               RegisterName(other->assigned_register()));
         LiveRange* split_off =
-            other->SplitAt(next_start, data()->allocation_zone());
+            other->SplitAt(next_start, allocation_zone());
         // Try to get the same register after the deferred block.
         split_off->set_controlflow_hint(other->assigned_register());
         DCHECK_NE(split_off, other);
@@ -3532,7 +3536,6 @@ void LinearScanAllocator::AllocateRegisters() {
   }
 
   SplitAndSpillRangesDefinedByMemoryOperand();
-  data()->ResetSpillState();
 
   if (v8_flags.trace_turbo_alloc) {
     PrintRangeOverview();
@@ -3608,7 +3611,7 @@ void LinearScanAllocator::AllocateRegisters() {
   // breaks with the invariant that we undo spills that happen in deferred code
   // when crossing a deferred/non-deferred boundary.
   while (!unhandled_live_ranges().empty() || last_block < max_blocks) {
-    data()->tick_counter()->TickAndMaybeEnterSafepoint();
+    tick_counter()->TickAndMaybeEnterSafepoint();
     LiveRange* current = unhandled_live_ranges().empty()
                              ? nullptr
                              : *unhandled_live_ranges().begin();
@@ -3634,7 +3637,7 @@ void LinearScanAllocator::AllocateRegisters() {
       // Store current spill state (as the state at end of block). For
       // simplicity, we store the active ranges, e.g., the live ranges that
       // are not spilled.
-      data()->RememberSpillState(last_block, active_live_ranges());
+      RememberSpillState(last_block, active_live_ranges());
 
       // Only reset the state if this was not a direct fallthrough. Otherwise
       // control flow resolution will get confused (it does not expect changes
@@ -3696,7 +3699,7 @@ void LinearScanAllocator::AllocateRegisters() {
           // boundary, there is nothing to do.
           bool is_noop = pred.IsNext(current_block->rpo_number());
           if (!is_noop) {
-            auto& spill_state = data()->GetSpillState(pred);
+            auto& spill_state = GetSpillState(pred);
             TRACE("Not a fallthrough. Adding %zu elements...\n",
                   spill_state.size());
             LifetimePosition pred_end =
@@ -293,7 +293,7 @@ class RegisterAllocationData final : public ZoneObject {
   TopLevelLiveRange* NewLiveRange(int index, MachineRepresentation rep);
 
   SpillRange* AssignSpillRangeToLiveRange(TopLevelLiveRange* range,
-                                          SpillMode spill_mode);
+                                          SpillMode spill_mode, Zone* zone);
   SpillRange* CreateSpillRangeForLiveRange(TopLevelLiveRange* range);
 
   MoveOperands* AddGapMove(int index, Instruction::GapPosition position,
@@ -318,22 +318,6 @@ class RegisterAllocationData final : public ZoneObject {
     return preassigned_slot_ranges_;
   }
 
-  void RememberSpillState(RpoNumber block,
-                          const ZoneVector<LiveRange*>& state) {
-    spill_state_[block.ToSize()] = state;
-  }
-
-  ZoneVector<LiveRange*>& GetSpillState(RpoNumber block) {
-    auto& result = spill_state_[block.ToSize()];
-    return result;
-  }
-
-  void ResetSpillState() {
-    for (auto& state : spill_state_) {
-      state.clear();
-    }
-  }
-
   TickCounter* tick_counter() { return tick_counter_; }
 
   ZoneMap<TopLevelLiveRange*, AllocatedOperand*>& slot_for_const_range() {
@@ -363,7 +347,6 @@ class RegisterAllocationData final : public ZoneObject {
   BitVector* fixed_simd128_register_use_;
   int virtual_register_count_;
   RangesWithPreassignedSlots preassigned_slot_ranges_;
-  ZoneVector<ZoneVector<LiveRange*>> spill_state_;
   TickCounter* const tick_counter_;
   ZoneMap<TopLevelLiveRange*, AllocatedOperand*> slot_for_const_range_;
 };
@@ -1181,6 +1164,16 @@ class V8_EXPORT_PRIVATE TopLevelLiveRange final : public LiveRange {
 
   const ZoneVector<LiveRange*>& Children() const { return children_; }
 
+  // Moves the children cache to {zone}, so that splitting this range and
+  // merging its children only allocate in {zone}. Used when the range is
+  // allocated concurrently with ranges of another register kind. The range
+  // must not have been split yet.
+  void MoveChildrenToZone(Zone* zone) {
+    DCHECK_EQ(children_.size(), 1);
+    DCHECK_EQ(children_[0], this);
+    children_ = ZoneVector<LiveRange*>({this}, zone);
+  }
+
   int GetNextChildId() { return ++last_child_id_; }
 
   bool IsSpilledOnlyInDeferredBlocks(const RegisterAllocationData* data) const {
@@ -1465,6 +1458,17 @@ class RegisterAllocator : public ZoneObject {
   RegisterAllocator(const RegisterAllocator&) = delete;
   RegisterAllocator& operator=(const RegisterAllocator&) = delete;
 
+  // Lets the allocator run concurrently with an allocator for another
+  // register kind. Split off live ranges and new spill ranges are then
+  // allocated in {allocation_zone}, and work is counted on {tick_counter}
+  // because the pipeline's tick counter may only be used on the compiling
+  // thread.
+  void PrepareForConcurrentAllocation(Zone* allocation_zone,
+                                      TickCounter* tick_counter) {
+    allocation_zone_ = allocation_zone;
+    tick_counter_ = tick_counter;
+  }
+
  protected:
   using SpillMode = RegisterAllocationData::SpillMode;
   RegisterAllocationData* data() const { return data_; }
@@ -1482,7 +1486,8 @@ class RegisterAllocator : public ZoneObject {
   LifetimePosition GetSplitPositionForInstruction(const LiveRange* range,
                                                   int instruction_index);
 
-  Zone* allocation_zone() const { return data()->allocation_zone(); }
+  Zone* allocation_zone() const { return allocation_zone_; }
+  TickCounter* tick_counter() const { return tick_counter_; }
 
   // Find the optimal split for ranges defined by a memory operand, e.g.
   // constants or function parameters passed on the stack.
@@ -1529,6 +1534,8 @@ class RegisterAllocator : public ZoneObject {
   int num_allocatable_registers_;
   const int* allocatable_register_codes_;
   bool check_fp_aliasing_;
+  Zone* allocation_zone_;
+  TickCounter* tick_counter_;
 
  private:
   bool no_combining_;
@@ -1678,6 +1685,15 @@ class LinearScanAllocator final : public RegisterAllocator {
 
   void PrintRangeOverview();
 
+  void RememberSpillState(RpoNumber block,
+                          const ZoneVector<LiveRange*>& state) {
+    spill_state_[block.ToSize()] = state;
+  }
+
+  ZoneVector<LiveRange*>& GetSpillState(RpoNumber block) {
+    return spill_state_[block.ToSize()];
+  }
+
   UnhandledLiveRangeQueue unhandled_live_ranges_;
   ZoneVector<LiveRange*> active_live_ranges_;
   ZoneVector<InactiveLiveRangeQueue> inactive_live_ranges_;
@@ -1687,6 +1703,9 @@ class LinearScanAllocator final : public RegisterAllocator {
   LifetimePosition next_active_ranges_change_;
   LifetimePosition next_inactive_ranges_change_;
 
+  // The active ranges at the end of each block.
+  ZoneVector<ZoneVector<LiveRange*>> spill_state_;
+
 #ifdef DEBUG
   LifetimePosition allocation_finger_;
 #endif
@@ -160,6 +160,9 @@ struct RegisterComponent
   using ComponentWithZone::ComponentWithZone;
 
   Pointer<RegisterAllocationData> allocation_data = nullptr;
+  // Holds the live ranges and spill ranges that the floating point register
+  // allocator creates when it runs concurrently with the general one.
+  base::Optional<ZoneWithName<kRegisterAllocationZoneName>> fp_zone;
 };
 }  // namespace detail
 
@@ -338,6 +341,13 @@ class V8_EXPORT_PRIVATE PipelineData {
   ZoneWithName<kRegisterAllocationZoneName>& register_allocation_zone() {
     return register_component_->zone;
   }
+  ZoneWithName<kRegisterAllocationZoneName>& fp_register_allocation_zone() {
+    if (!register_component_->fp_zone.has_value()) {
+      register_component_->fp_zone.emplace(zone_stats(),
+                                           kRegisterAllocationZoneName);
+    }
+    return *register_component_->fp_zone;
+  }
   CodeGenerator* code_generator() const {
     return codegen_component_->code_generator.get();
   }
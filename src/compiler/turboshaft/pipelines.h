@@ -421,10 +421,15 @@ class Pipeline {
                                          data_->register_allocation_data());
     }
 
-    Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
+    if (AllocateGeneralAndFPRegistersPhase<LinearScanAllocator>::ShouldRun(
+            data_)) {
+      Run<AllocateGeneralAndFPRegistersPhase<LinearScanAllocator>>();
+    } else {
+      Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
 
-    if (data_->sequence()->HasFPVirtualRegisters()) {
-      Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
+      if (data_->sequence()->HasFPVirtualRegisters()) {
+        Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
+      }
     }
 
     if (data_->sequence()->HasSimd128VirtualRegisters() &&
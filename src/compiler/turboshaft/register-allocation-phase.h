@@ -5,6 +5,12 @@
 #ifndef V8_COMPILER_TURBOSHAFT_REGISTER_ALLOCATION_PHASE_H_
 #define V8_COMPILER_TURBOSHAFT_REGISTER_ALLOCATION_PHASE_H_
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "include/v8-platform.h"
+#include "src/codegen/tick-counter.h"
 #include "src/compiler/backend/frame-elider.h"
 #include "src/compiler/backend/jump-threading.h"
 #include "src/compiler/backend/move-optimizer.h"
@@ -13,6 +19,8 @@
 #include "src/compiler/turboshaft/copying-phase.h"
 #include "src/compiler/turboshaft/phase.h"
 #include "src/compiler/turboshaft/value-numbering-reducer.h"
+#include "src/compiler/zone-stats.h"
+#include "src/init/v8.h"
 
 namespace v8::internal::compiler::turboshaft {
 
@@ -80,6 +88,90 @@ struct AllocateFPRegistersPhase {
   }
 };
 
+// Allocates general and floating point registers on two threads. The two
+// allocators work on disjoint sets of live ranges, and everything that the
+// floating point allocator allocates goes into a zone of its own: split off
+// ranges, spill ranges, merged use intervals and the children caches of its
+// top level ranges. The remaining shared state is either read-only during
+// allocation (live range table, phi map, fixed ranges, the instruction
+// sequence) or written per register kind (the assigned register bit vectors
+// in MarkAllocated, and the phi map values of each kind's phis).
+template <typename RegAllocator>
+struct AllocateGeneralAndFPRegistersPhase {
+  DECL_TURBOSHAFT_PHASE_CONSTANTS_WITH_LEGACY_NAME(
+      AllocateGeneralAndFPRegisters)
+  static constexpr bool kOutputIsTraceableGraph = false;
+
+  class AllocateRegistersJob final : public JobTask {
+   public:
+    AllocateRegistersJob(RegisterAllocationData* data, Zone* general_zone,
+                         Zone* fp_zone, Zone* fp_allocation_zone)
+        : data_(data),
+          local_zones_{general_zone, fp_zone},
+          allocation_zones_{data->allocation_zone(), fp_allocation_zone} {}
+
+    void Run(JobDelegate* delegate) final {
+      for (size_t index = next_index_.fetch_add(1, std::memory_order_relaxed);
+           index < kNumKinds;
+           index = next_index_.fetch_add(1, std::memory_order_relaxed)) {
+        // Safepoints may only be entered on the compiling thread.
+        TickCounter tick_counter;
+        RegAllocator allocator(data_, kKinds[index], local_zones_[index]);
+        allocator.PrepareForConcurrentAllocation(
+            allocation_zones_[index], delegate->IsJoiningThread()
+                                          ? data_->tick_counter()
+                                          : &tick_counter);
+        allocator.AllocateRegisters();
+      }
+    }
+
+    size_t GetMaxConcurrency(size_t worker_count) const final {
+      size_t started = std::min(
+          next_index_.load(std::memory_order_relaxed), kNumKinds);
+      return worker_count + kNumKinds - started;
+    }
+
+   private:
+    static constexpr size_t kNumKinds = 2;
+    static constexpr RegisterKind kKinds[kNumKinds] = {RegisterKind::kGeneral,
+                                                       RegisterKind::kDouble};
+
+    RegisterAllocationData* const data_;
+    Zone* const local_zones_[kNumKinds];
+    Zone* const allocation_zones_[kNumKinds];
+    std::atomic<size_t> next_index_{0};
+  };
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    ZoneStats::Scope fp_temp_zone(data->zone_stats(), phase_name());
+    // Zones are created lazily, which is not thread-safe.
+    Zone* fp_allocation_zone = data->fp_register_allocation_zone();
+    RegisterAllocationData* allocation_data = data->register_allocation_data();
+    // Splitting a range inserts into the children cache of its top level
+    // range, which would otherwise grow in the shared allocation zone.
+    for (TopLevelLiveRange* range : allocation_data->live_ranges()) {
+      if (range->kind() == RegisterKind::kDouble) {
+        range->MoveChildrenToZone(fp_allocation_zone);
+      }
+    }
+    auto job = std::make_unique<AllocateRegistersJob>(
+        allocation_data, temp_zone, fp_temp_zone.zone(), fp_allocation_zone);
+    V8::GetCurrentPlatform()
+        ->PostJob(TaskPriority::kUserVisible, std::move(job))
+        ->Join();
+  }
+
+  // Only large functions make up for the cost of the extra thread.
+  static bool ShouldRun(PipelineData* data) {
+    return v8_flags.turboshaft_concurrent_register_allocation &&
+           !v8_flags.trace_turbo_alloc &&
+           data->sequence()->HasFPVirtualRegisters() &&
+           static_cast<int>(data->sequence()->instructions().size()) >=
+               v8_flags
+                   .turboshaft_concurrent_register_allocation_min_instructions;
+  }
+};
+
 template <typename RegAllocator>
 struct AllocateSimd128RegistersPhase {
   DECL_TURBOSHAFT_PHASE_CONSTANTS_WITH_LEGACY_NAME(AllocateSimd128Registers)
@@ -335,6 +335,7 @@ bool DebugEvaluate::IsSideEffectFreeIntrinsic(Runtime::FunctionId id) {
   V(ThrowReferenceError)                 \
   V(ThrowSymbolIteratorInvalid)          \
   /* Strings */                          \
+  V(StringIndexOfUnchecked)              \
   V(StringReplaceOneCharWithString)      \
   V(StringSubstring)                     \
   V(StringToNumber)                      \
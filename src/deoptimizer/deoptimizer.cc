@@ -8,6 +8,7 @@
 #include "src/codegen/interface-descriptors.h"
 #include "src/codegen/register-configuration.h"
 #include "src/codegen/reloc-info.h"
+#include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/debug/debug.h"
 #include "src/deoptimizer/deoptimized-frame-info.h"
 #include "src/deoptimizer/materialized-object-store.h"
@@ -1529,6 +1530,11 @@ void Deoptimizer::DoComputeOutputFrames() {
                                        compiled_code_->osr_offset())))) {
     function_->reset_tiering_state();
     function_->SetInterruptBudget(isolate_, CodeKind::INTERPRETED_FUNCTION);
+    if (v8_flags.concurrent_recompilation_discard_stale_jobs &&
+        isolate()->concurrent_recompilation_enabled()) {
+      isolate()->optimizing_compile_dispatcher()->DiscardStartedJobs(
+          function_);
+    }
   }
 
   // Print some helpful diagnostic information.
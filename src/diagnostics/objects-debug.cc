@@ -1994,12 +1994,17 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
 
         CHECK(IsByteArray(latin1_bytecode));
         CHECK_EQ(uc16_bytecode, latin1_bytecode);
+
+        Tagged<Object> dfa = arr->get(JSRegExp::kExperimentalDfaIndex);
+        CHECK(dfa == uninitialized || IsForeign(dfa) || IsUndefined(dfa));
       } else {
         CHECK_EQ(latin1_code, uninitialized);
         CHECK_EQ(uc16_code, uninitialized);
 
         CHECK_EQ(latin1_bytecode, uninitialized);
         CHECK_EQ(uc16_bytecode, uninitialized);
+
+        CHECK_EQ(arr->get(JSRegExp::kExperimentalDfaIndex), uninitialized);
       }
 
       CHECK_EQ(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex),
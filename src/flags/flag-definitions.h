@@ -594,6 +594,7 @@ DEFINE_WEAK_IMPLICATION(maglev_future, maglev_optimistic_peeled_loops)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_speculative_hoist_phi_untagging)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_inline_api_calls)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_escape_analysis)
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_bounds_check_elimination)
 // This might be too big of a hammer but we must prohibit moving the C++
 // trampolines while we are executing a C++ code.
 DEFINE_NEG_IMPLICATION(maglev_inline_api_calls, compact_code_space_with_stack)
@@ -639,6 +640,9 @@ DEFINE_EXPERIMENTAL_FEATURE(
     "enable phi untagging to hoist untagging of loop phi inputs (could "
     "still cause deopt loops)")
 DEFINE_BOOL(maglev_cse, true, "common subexpression elimination")
+DEFINE_BOOL(maglev_bounds_check_elimination, false,
+            "remove bounds checks of non-negative induction variables that "
+            "are dominated by a loop condition against the same length")
 
 DEFINE_STRING(maglev_filter, "*", "optimization filter for the maglev compiler")
 DEFINE_BOOL(maglev_assert, false, "insert extra assertion in maglev code")
@@ -1080,8 +1084,11 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(concurrent_recompilation_front_running, true,
-            "move compile jobs to the front if recompilation is requested "
-            "multiple times")
+            "compile jobs first whose recompilation is requested the most "
+            "times while they wait")
+DEFINE_BOOL(concurrent_recompilation_discard_stale_jobs, true,
+            "drop the results of running compile jobs for functions that "
+            "deoptimize in the meantime")
 DEFINE_UINT(
     concurrent_turbofan_max_threads, 4,
     "max number of threads that concurrent Turbofan can use (0 for unbounded)")
@@ -1410,6 +1417,11 @@ DEFINE_BOOL(turboshaft_load_elimination, true,
 DEFINE_BOOL(turboshaft_loop_peeling, false, "enable Turboshaft's loop peeling")
 DEFINE_BOOL(turboshaft_loop_unrolling, true,
             "enable Turboshaft's loop unrolling")
+DEFINE_BOOL(turboshaft_concurrent_register_allocation, false,
+            "allocate general and floating point registers on two threads")
+DEFINE_INT(turboshaft_concurrent_register_allocation_min_instructions, 5000,
+           "minimum number of instructions of a function to allocate its "
+           "registers on two threads")
 
 DEFINE_EXPERIMENTAL_FEATURE(turboshaft_typed_optimizations,
                             "enable an additional Turboshaft phase that "
@@ -1487,6 +1499,12 @@ DEFINE_BOOL(profile_guided_optimization_for_empty_feedback_vector, true,
             "profile guided optimization for empty feedback vector")
 DEFINE_INT(invocation_count_for_early_optimization, 30,
            "invocation count threshold for early optimization")
+DEFINE_BOOL(profile_guided_optimization_in_code_cache, false,
+            "keep the tiering decisions of functions in the code cache, so "
+            "that functions which were hot before tier up early after the "
+            "cache is consumed")
+DEFINE_NEG_NEG_IMPLICATION(profile_guided_optimization,
+                           profile_guided_optimization_in_code_cache)
 
 // Favor memory over execution speed.
 DEFINE_BOOL(optimize_for_size, false,
@@ -1860,6 +1878,9 @@ DEFINE_BOOL(trace_gc_nvp, false,
 DEFINE_BOOL(trace_gc_ignore_scavenger, false,
             "do not print trace line after scavenger collection")
 DEFINE_BOOL(trace_memory_reducer, false, "print memory reducer behavior")
+DEFINE_BOOL(trace_gc_profile, false,
+            "print garbage collection statistics of a GC profile when the "
+            "embedder switches to another one")
 DEFINE_BOOL(trace_gc_verbose, false,
             "print more details following each garbage collection")
 DEFINE_IMPLICATION(trace_gc_verbose, trace_gc)
@@ -1907,6 +1928,9 @@ DEFINE_INT(incremental_marking_hard_trigger, 0,
            "of available space: limit - size")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
+DEFINE_BOOL(parallel_scavenge_scheduling, true,
+            "share the worker threads between the parallel scavenges of all "
+            "isolates in proportion to their estimated pause times")
 DEFINE_BOOL(minor_gc_task, true, "schedule scavenge tasks")
 DEFINE_UINT(minor_gc_task_trigger, 80,
             "minor GC task trigger in percent of the current heap limit")
@@ -2009,6 +2033,10 @@ DEFINE_INT(memory_reducer_gc_count, 2,
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(huge_pages_for_heap, false,
+            "advise the OS to back the heap reservations (pointer compression "
+            "cage, trusted range, and the code range in jitless mode) with "
+            "transparent huge pages, where the page allocator supports it")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
@@ -2016,6 +2044,10 @@ DEFINE_BOOL(compact_code_space, true,
             "Perform code space compaction on full collections.")
 DEFINE_BOOL(compact_on_every_full_gc, false,
             "Perform compaction on every full GC")
+DEFINE_FLOAT(compaction_pause_budget_ms, 0.0,
+             "Upper bound for the estimated time spent evacuating old "
+             "generation pages in the atomic pause of a full GC. Pages beyond "
+             "it are left for later GCs (0 for no bound, the default)")
 DEFINE_BOOL(compact_with_stack, true,
             "Perform compaction when finalizing a full GC with stack")
 DEFINE_BOOL(
@@ -2569,6 +2601,11 @@ DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+DEFINE_BOOL(map_read_only_snapshot, false,
+            "Lay out the read-only snapshot such that it can be mapped into "
+            "the read-only space from a file-backed snapshot blob instead of "
+            "being copied. Only has an effect when creating snapshots with "
+            "static roots and without snapshot compression.")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
@@ -2578,14 +2615,21 @@ DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
 #define REGEXP_PEEPHOLE_OPTIMIZATION_BOOL true
 #endif
 DEFINE_BOOL(regexp_tier_up, true,
-            "enable regexp interpreter and tier up to the compiler after the "
-            "number of executions set by the tier up ticks flag")
+            "enable regexp interpreter and tier up to the compiler once the "
+            "interpreted executions used up the tier up ticks")
 DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
-DEFINE_INT(regexp_tier_up_ticks, 1,
-           "set the number of executions for the regexp interpreter before "
-           "tiering-up to the compiler")
+DEFINE_INT(regexp_tier_up_ticks, 8,
+           "set the number of cheap executions for the regexp interpreter "
+           "before tiering-up to the compiler")
+DEFINE_INT(regexp_tier_up_work_per_tick, 256,
+           "interpreter work (subject characters matched over plus weighted "
+           "backtracks) an execution can do before it costs an additional "
+           "tier up tick")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
+DEFINE_UINT(regexp_shared_bytecode_cache_size_kb, 1024,
+            "maximum size of the regexp bytecode cache shared by all isolates "
+            "of the process (0 to disable)")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
             "trace regexp bytecode peephole optimization")
 DEFINE_BOOL(trace_regexp_bytecodes, false, "trace regexp bytecode execution")
@@ -2608,6 +2652,9 @@ DEFINE_IMPLICATION(experimental_regexp_engine_capture_group_opt,
 DEFINE_UINT64(experimental_regexp_engine_capture_group_opt_max_memory_usage,
               1024,
               "maximum memory usage in MB allowed for experimental engine")
+DEFINE_BOOL(experimental_regexp_engine_dfa, true,
+            "find match ends of the experimental regexp engine with a lazily "
+            "built DFA where possible")
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
 
@@ -3128,6 +3175,8 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded,
+                       turboshaft_concurrent_register_allocation)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
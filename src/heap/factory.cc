@@ -313,6 +313,114 @@ Tagged<HeapObject> Factory::AllocateRawWithAllocationSite(
   return result;
 }
 
+Tagged<HeapObject> Factory::AllocateRawWithRuntimeAllocationSite(
+    int size, RuntimeAllocationSite site) {
+  const int aligned_size = ALIGN_TO_ALLOCATION_ALIGNMENT(size);
+  const int memento_size =
+      ALIGN_TO_ALLOCATION_ALIGNMENT(AllocationMemento::kSize);
+  if (!V8_ALLOCATION_SITE_TRACKING_BOOL ||
+      !v8_flags.allocation_site_pretenuring ||
+      size < PretenuringHandler::kMinRuntimeAllocationSiteObjectSize ||
+      aligned_size + memento_size >
+          isolate()->heap()->MaxRegularHeapObjectSize(AllocationType::kYoung)) {
+    return AllocateRawArray(size, AllocationType::kYoung);
+  }
+  DirectHandle<AllocationSite> allocation_site =
+      isolate()->heap()->pretenuring_handler()->GetRuntimeAllocationSite(site);
+  if (allocation_site->GetAllocationType() == AllocationType::kOld) {
+    return AllocateRawArray(size, AllocationType::kOld);
+  }
+  Tagged<HeapObject> result =
+      allocator()->AllocateRawWith<HeapAllocator::kRetryOrFail>(
+          aligned_size + memento_size, AllocationType::kYoung);
+  Tagged<AllocationMemento> alloc_memento = UncheckedCast<AllocationMemento>(
+      Tagged<Object>(result.ptr() + aligned_size));
+  InitializeAllocationMemento(alloc_memento, *allocation_site);
+  return result;
+}
+
+Handle<FixedArray> Factory::NewFixedArrayWithHoles(int length,
+                                                   RuntimeAllocationSite site) {
+  DCHECK_LE(0, length);
+  if (length == 0) return empty_fixed_array();
+  if (length > FixedArray::kMaxLength) {
+    FATAL("Fatal JavaScript invalid size error %d", length);
+  }
+  Tagged<HeapObject> result =
+      AllocateRawWithRuntimeAllocationSite(FixedArray::SizeFor(length), site);
+  DisallowGarbageCollection no_gc;
+  result->set_map_after_allocation(*fixed_array_map(), SKIP_WRITE_BARRIER);
+  Tagged<FixedArray> array = Cast<FixedArray>(result);
+  array->set_length(length);
+  MemsetTagged(array->RawFieldOfFirstElement(), *the_hole_value(), length);
+  return handle(array, isolate());
+}
+
+Handle<FixedArrayBase> Factory::NewFixedDoubleArray(
+    int length, RuntimeAllocationSite site) {
+  if (V8_UNLIKELY(static_cast<unsigned>(length) >
+                  FixedDoubleArray::kMaxLength)) {
+    FATAL("Fatal JavaScript invalid size error %d (see crbug.com/1201626)",
+          length);
+  } else if (V8_UNLIKELY(length == 0)) {
+    return empty_fixed_array();
+  }
+  Tagged<HeapObject> result = AllocateRawWithRuntimeAllocationSite(
+      FixedDoubleArray::SizeFor(length), site);
+  DisallowGarbageCollection no_gc;
+  result->set_map_after_allocation(*fixed_double_array_map(),
+                                   SKIP_WRITE_BARRIER);
+  Tagged<FixedDoubleArray> array = Cast<FixedDoubleArray>(result);
+  array->set_length(length);
+  return handle(array, isolate());
+}
+
+template <typename SeqStringT>
+MaybeHandle<SeqStringT> Factory::NewRawStringWithRuntimeAllocationSite(
+    int length, Tagged<Map> map, RuntimeAllocationSite site) {
+  DCHECK_EQ(RefineAllocationTypeForInPlaceInternalizableString(
+                AllocationType::kYoung, map),
+            AllocationType::kYoung);
+  if (length > String::kMaxLength || length < 0) {
+    THROW_NEW_ERROR(isolate(), NewInvalidStringLengthError());
+  }
+  DCHECK_GT(length, 0);  // Use Factory::empty_string() instead.
+  int size = SeqStringT::SizeFor(length);
+  Tagged<HeapObject> result = AllocateRawWithRuntimeAllocationSite(size, site);
+  DisallowGarbageCollection no_gc;
+  result->set_map_after_allocation(map, SKIP_WRITE_BARRIER);
+  Tagged<SeqStringT> string = Cast<SeqStringT>(result);
+  string->clear_padding_destructively(length);
+  string->set_length(length);
+  string->set_raw_hash_field(String::kEmptyHashField);
+  DCHECK_EQ(size, string->Size());
+  return handle(string, isolate());
+}
+
+MaybeHandle<SeqOneByteString> Factory::NewRawOneByteString(
+    int length, RuntimeAllocationSite site) {
+  Tagged<Map> map = *seq_one_byte_string_map();
+  // Strings that have to be allocated in a specific space, e.g. for in-place
+  // internalization into a shared string table, don't collect feedback.
+  if (RefineAllocationTypeForInPlaceInternalizableString(
+          AllocationType::kYoung, map) != AllocationType::kYoung) {
+    return NewRawOneByteString(length);
+  }
+  return NewRawStringWithRuntimeAllocationSite<SeqOneByteString>(length, map,
+                                                                 site);
+}
+
+MaybeHandle<SeqTwoByteString> Factory::NewRawTwoByteString(
+    int length, RuntimeAllocationSite site) {
+  Tagged<Map> map = *seq_two_byte_string_map();
+  if (RefineAllocationTypeForInPlaceInternalizableString(
+          AllocationType::kYoung, map) != AllocationType::kYoung) {
+    return NewRawTwoByteString(length);
+  }
+  return NewRawStringWithRuntimeAllocationSite<SeqTwoByteString>(length, map,
+                                                                 site);
+}
+
 void Factory::InitializeAllocationMemento(
     Tagged<AllocationMemento> memento, Tagged<AllocationSite> allocation_site) {
   DCHECK(V8_ALLOCATION_SITE_TRACKING_BOOL);
@@ -4027,6 +4135,7 @@ void Factory::SetRegExpExperimentalData(DirectHandle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
   store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, uninitialized);
   store->set(JSRegExp::kIrregexpBacktrackLimit, uninitialized);
+  store->set(JSRegExp::kExperimentalDfaIndex, uninitialized);
   regexp->set_data(store);
 }
 
@@ -158,6 +158,26 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
   // Allocate a new fixed double array with hole values.
   Handle<FixedArrayBase> NewFixedDoubleArrayWithHoles(int size);
 
+  // Import overloads from base class.
+  using FactoryBase::NewFixedArrayWithHoles;
+  using FactoryBase::NewFixedDoubleArray;
+  using FactoryBase::NewRawOneByteString;
+  using FactoryBase::NewRawTwoByteString;
+
+  // Allocate backing stores for runtime paths without an AllocationSite of
+  // their own. Large backing stores collect pretenuring feedback through the
+  // site's memento and are allocated in old space once the PretenuringHandler
+  // decided to pretenure the site.
+  Handle<FixedArray> NewFixedArrayWithHoles(int length,
+                                            RuntimeAllocationSite site);
+  // The elements of the array are uninitialized.
+  Handle<FixedArrayBase> NewFixedDoubleArray(int length,
+                                             RuntimeAllocationSite site);
+  V8_WARN_UNUSED_RESULT MaybeHandle<SeqOneByteString> NewRawOneByteString(
+      int length, RuntimeAllocationSite site);
+  V8_WARN_UNUSED_RESULT MaybeHandle<SeqTwoByteString> NewRawTwoByteString(
+      int length, RuntimeAllocationSite site);
+
   // Allocates a NameDictionary with an internal capacity calculated such that
   // |at_least_space_for| entries can be added without reallocating.
   Handle<NameDictionary> NewNameDictionary(int at_least_space_for);
@@ -1251,6 +1271,15 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
       DirectHandle<Map> map, AllocationType allocation,
       DirectHandle<AllocationSite> allocation_site);
 
+  // Allocates `size` bytes for a backing store of a RuntimeAllocationSite,
+  // followed by a memento if the site collects feedback for it.
+  Tagged<HeapObject> AllocateRawWithRuntimeAllocationSite(
+      int size, RuntimeAllocationSite site);
+
+  template <typename SeqStringT>
+  MaybeHandle<SeqStringT> NewRawStringWithRuntimeAllocationSite(
+      int length, Tagged<Map> map, RuntimeAllocationSite site);
+
   Handle<JSArrayBufferView> NewJSArrayBufferView(
       DirectHandle<Map> map, DirectHandle<FixedArrayBase> elements,
       DirectHandle<JSArrayBuffer> buffer, size_t byte_offset,
@@ -176,19 +176,41 @@ GCTracer::GCTracer(Heap* heap, base::TimeTicks startup_time,
                nullptr),
       previous_(current_),
       allocation_time_(startup_time),
-      previous_mark_compact_end_time_(startup_time) {
+      previous_mark_compact_end_time_(startup_time),
+      gc_profile_start_time_(startup_time) {
   // All accesses to incremental_marking_scope assume that incremental marking
   // scopes come first.
   static_assert(0 == Scope::FIRST_INCREMENTAL_SCOPE);
   // We assume that MC_INCREMENTAL is the first scope so that we can properly
   // map it to RuntimeCallStats.
   static_assert(0 == Scope::MC_INCREMENTAL);
+  // One statistics entry per GC profile.
+  static_assert(kGCProfileCount ==
+                static_cast<size_t>(GarbageCollectionProfile::kMemorySaver) +
+                    1);
   // Starting a new cycle will make the current event the previous event.
   // Setting the current end time here allows us to refer back to a previous
   // event's end time to compute time spent in mutator.
   current_.end_time = previous_mark_compact_end_time_;
 }
 
+namespace {
+
+const char* ToString(v8::GarbageCollectionProfile profile) {
+  switch (profile) {
+    case v8::GarbageCollectionProfile::kDefault:
+      return "default";
+    case v8::GarbageCollectionProfile::kLowLatency:
+      return "low-latency";
+    case v8::GarbageCollectionProfile::kThroughput:
+      return "throughput";
+    case v8::GarbageCollectionProfile::kMemorySaver:
+      return "memory-saver";
+  }
+}
+
+}  // namespace
+
 void GCTracer::ResetForTesting() {
   auto* heap = heap_;
   this->~GCTracer();
@@ -373,6 +395,19 @@ void GCTracer::StopObservablePause(GarbageCollector collector,
 
   heap_->UpdateTotalGCTime(duration);
 
+  GCProfileStatistics& profile_statistics =
+      gc_profile_statistics_[static_cast<size_t>(heap_->gc_profile())];
+  if (is_young) {
+    profile_statistics.young_gcs++;
+  } else {
+    profile_statistics.full_gcs++;
+    profile_statistics.incremental_marking +=
+        current_.incremental_marking_duration;
+  }
+  profile_statistics.total_pause += duration;
+  profile_statistics.max_pause =
+      std::max(profile_statistics.max_pause, duration);
+
   if (v8_flags.trace_gc_ignore_scavenger && is_young) return;
 
   if (v8_flags.trace_gc_nvp) {
@@ -1878,6 +1913,43 @@ GarbageCollector GCTracer::GetCurrentCollector() const {
   }
 }
 
+GCTracer::GCProfileStatistics GCTracer::GetGCProfileStatistics(
+    v8::GarbageCollectionProfile profile) const {
+  GCProfileStatistics statistics =
+      gc_profile_statistics_[static_cast<size_t>(profile)];
+  if (profile == heap_->gc_profile()) {
+    statistics.active_time += base::TimeTicks::Now() - gc_profile_start_time_;
+  }
+  return statistics;
+}
+
+void GCTracer::NotifyGCProfileChanged(v8::GarbageCollectionProfile profile,
+                                      base::TimeTicks time) {
+  const v8::GarbageCollectionProfile previous_profile = heap_->gc_profile();
+  DCHECK_NE(previous_profile, profile);
+  GCProfileStatistics& statistics =
+      gc_profile_statistics_[static_cast<size_t>(previous_profile)];
+  const base::TimeDelta active_time = time - gc_profile_start_time_;
+  statistics.active_time += active_time;
+  gc_profile_start_time_ = time;
+
+  if (V8_UNLIKELY(v8_flags.trace_gc_profile)) {
+    const double active_ms = statistics.active_time.InMillisecondsF();
+    heap_->isolate()->PrintWithTimestamp(
+        "[GCProfile] %s -> %s: active for %.1f ms (%.1f ms total), %zu young "
+        "GCs, %zu full GCs, pauses %.1f ms (%.1f%%), max pause %.1f ms, "
+        "incremental marking %.1f ms\n",
+        ToString(previous_profile), ToString(profile),
+        active_time.InMillisecondsF(), active_ms, statistics.young_gcs,
+        statistics.full_gcs, statistics.total_pause.InMillisecondsF(),
+        active_ms > 0
+            ? 100 * statistics.total_pause.InMillisecondsF() / active_ms
+            : 0.0,
+        statistics.max_pause.InMillisecondsF(),
+        statistics.incremental_marking.InMillisecondsF());
+  }
+}
+
 #ifdef DEBUG
 bool GCTracer::IsInObservablePause() const {
   return start_of_observable_pause_.has_value();
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_GC_TRACER_H_
 #define V8_HEAP_GC_TRACER_H_
 
+#include <array>
 #include <optional>
 
 #include "include/v8-metrics.h"
@@ -18,6 +19,9 @@
 #include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
+
+enum class GarbageCollectionProfile;
+
 namespace internal {
 
 enum YoungGenerationSpeedMode {
@@ -459,6 +463,27 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   GarbageCollector GetCurrentCollector() const;
 
+  // Garbage collections performed while a GC profile was active (see
+  // Heap::SetGarbageCollectionProfile).
+  struct GCProfileStatistics {
+    base::TimeDelta active_time;
+    size_t young_gcs = 0;
+    size_t full_gcs = 0;
+    base::TimeDelta total_pause;
+    base::TimeDelta max_pause;
+    base::TimeDelta incremental_marking;
+  };
+
+  // Returns the statistics for `profile`, including the time the currently
+  // active profile has been active for so far.
+  GCProfileStatistics GetGCProfileStatistics(
+      v8::GarbageCollectionProfile profile) const;
+
+  // Invoked before the heap switches to `profile`. Closes the statistics of
+  // the current profile and prints them with --trace-gc-profile.
+  void NotifyGCProfileChanged(v8::GarbageCollectionProfile profile,
+                              base::TimeTicks time);
+
  private:
   using BytesAndDurationBuffer = ::heap::base::BytesAndDurationBuffer;
 
@@ -558,6 +583,12 @@ class V8_EXPORT_PRIVATE GCTracer {
   base::TimeTicks previous_mark_compact_end_time_;
   base::TimeDelta total_duration_since_last_mark_compact_;
 
+  // Number of v8::GarbageCollectionProfile values, checked in gc-tracer.cc.
+  static constexpr size_t kGCProfileCount = 4;
+  std::array<GCProfileStatistics, kGCProfileCount> gc_profile_statistics_;
+  // Start of the time frame in which the current profile is active.
+  base::TimeTicks gc_profile_start_time_;
+
   BytesAndDurationBuffer recorded_minor_gcs_total_;
   BytesAndDurationBuffer recorded_compactions_;
   BytesAndDurationBuffer recorded_incremental_mark_compacts_;
@@ -21,6 +21,9 @@ struct BaseControllerTrait {
   static constexpr double kMaxGrowingFactor = 4.0;
   static constexpr double kConservativeGrowingFactor = 1.3;
   static constexpr double kTargetMutatorUtilization = 0.97;
+  // Used with GarbageCollectionProfile::kThroughput, which trades heap size
+  // for less time spent in garbage collection.
+  static constexpr double kThroughputTargetMutatorUtilization = 0.99;
 };
 
 struct V8HeapTrait : public BaseControllerTrait {
@@ -49,11 +52,13 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
 
  private:
   static double MaxGrowingFactor(size_t max_heap_size);
-  static double DynamicGrowingFactor(double gc_speed, double mutator_speed,
-                                     double max_factor);
+  static double DynamicGrowingFactor(
+      double gc_speed, double mutator_speed, double max_factor,
+      double target_mutator_utilization = Trait::kTargetMutatorUtilization);
 
   FRIEND_TEST(MemoryControllerTest, HeapGrowingFactor);
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
+  FRIEND_TEST(MemoryControllerTest, ThroughputHeapGrowingFactor);
 };
 
 }  // namespace internal
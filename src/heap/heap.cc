@@ -3886,6 +3886,7 @@ bool Heap::HasHighFragmentation() {
 bool Heap::ShouldOptimizeForMemoryUsage() {
   const size_t kOldGenerationSlack = max_old_generation_size() / 8;
   return v8_flags.optimize_for_size || isolate()->EfficiencyModeEnabled() ||
+         gc_profile_ == GarbageCollectionProfile::kMemorySaver ||
          HighMemoryPressure() || !CanExpandOldGeneration(kOldGenerationSlack);
 }
 
@@ -3936,13 +3937,37 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
   static const size_t kLowAllocationThroughput = 1000;
   const double allocation_throughput =
       tracer_->CurrentAllocationThroughputInBytesPerMillisecond();
-  const bool should_shrink = !v8_flags.predictable &&
-                             (allocation_throughput != 0) &&
-                             (allocation_throughput < kLowAllocationThroughput);
-
+  const bool should_shrink =
+      !v8_flags.predictable && (allocation_throughput != 0) &&
+      (allocation_throughput < kLowAllocationThroughput) &&
+      gc_profile_ != GarbageCollectionProfile::kThroughput;
+
+  // The GC profile decides how large the young generation gets and thereby
+  // how often minor GCs run: the memory saver profile doesn't grow it, the
+  // low-latency profile keeps it below half of its maximum capacity for
+  // shorter minor GC pauses, and the throughput profile grows it as soon as
+  // half of its capacity survived.
+  size_t max_capacity = new_space_->MaximumCapacity();
+  size_t growing_threshold = new_space_->TotalCapacity();
+  switch (gc_profile_) {
+    case GarbageCollectionProfile::kDefault:
+      break;
+    case GarbageCollectionProfile::kLowLatency:
+      max_capacity =
+          max_capacity / 2 /
+              static_cast<size_t>(v8_flags.semi_space_growth_factor) +
+          1;
+      break;
+    case GarbageCollectionProfile::kThroughput:
+      growing_threshold /= 2;
+      break;
+    case GarbageCollectionProfile::kMemorySaver:
+      max_capacity = 0;
+      break;
+  }
   const bool should_grow =
-      (new_space_->TotalCapacity() < new_space_->MaximumCapacity()) &&
-      (survived_since_last_expansion_ > new_space_->TotalCapacity());
+      (new_space_->TotalCapacity() < max_capacity) &&
+      (survived_since_last_expansion_ > growing_threshold);
 
   if (should_grow) survived_since_last_expansion_ = 0;
 
@@ -4274,6 +4299,14 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
   }
 }
 
+void Heap::SetGarbageCollectionProfile(GarbageCollectionProfile profile) {
+  if (profile == gc_profile_) return;
+  TRACE_EVENT1("devtools.timeline,v8", "V8.SetGarbageCollectionProfile",
+               "profile", static_cast<int>(profile));
+  tracer()->NotifyGCProfileChanged(profile, base::TimeTicks::Now());
+  gc_profile_ = profile;
+}
+
 void Heap::EagerlyFreeExternalMemoryAndWasmCode() {
 #if V8_ENABLE_WEBASSEMBLY
   if (v8_flags.flush_liftoff_code) {
@@ -589,6 +589,10 @@ class Heap final {
       v8::MemoryPressureLevel level, bool is_isolate_locked);
   void CheckMemoryPressure();
 
+  V8_EXPORT_PRIVATE void SetGarbageCollectionProfile(
+      v8::GarbageCollectionProfile profile);
+  v8::GarbageCollectionProfile gc_profile() const { return gc_profile_; }
+
   V8_EXPORT_PRIVATE void AddNearHeapLimitCallback(v8::NearHeapLimitCallback,
                                                   void* data);
   V8_EXPORT_PRIVATE void RemoveNearHeapLimitCallback(
@@ -2140,6 +2144,10 @@ class Heap final {
   // and reset by a mark-compact garbage collection.
   std::atomic<v8::MemoryPressureLevel> memory_pressure_level_;
 
+  // Selected by the embedder through Isolate::SetGarbageCollectionProfile.
+  v8::GarbageCollectionProfile gc_profile_ =
+      v8::GarbageCollectionProfile::kDefault;
+
   std::vector<std::pair<v8::NearHeapLimitCallback, void*>>
       near_heap_limit_callbacks_;
 
@@ -62,15 +62,23 @@ static constexpr size_t kV8ActivationThreshold = 0;
 static constexpr size_t kEmbedderActivationThreshold = 0;
 #endif  // DEBUG
 
-base::TimeDelta GetMaxDuration(StepOrigin step_origin) {
+base::TimeDelta GetMaxDuration(Heap* heap, StepOrigin step_origin) {
   if (v8_flags.predictable) {
     return base::TimeDelta::Max();
   }
-  switch (step_origin) {
-    case StepOrigin::kTask:
-      return kMaxStepSizeOnTask;
-    case StepOrigin::kV8:
-      return kMaxStepSizeOnAllocation;
+  const base::TimeDelta max_duration = step_origin == StepOrigin::kTask
+                                           ? kMaxStepSizeOnTask
+                                           : kMaxStepSizeOnAllocation;
+  // Shorter steps keep the pauses of the low-latency profile short, while
+  // longer steps amortize the per-step overhead for the throughput profile.
+  switch (heap->gc_profile()) {
+    case GarbageCollectionProfile::kLowLatency:
+      return max_duration / 2;
+    case GarbageCollectionProfile::kThroughput:
+      return max_duration * 2;
+    case GarbageCollectionProfile::kDefault:
+    case GarbageCollectionProfile::kMemorySaver:
+      return max_duration;
   }
 }
 
@@ -704,7 +712,7 @@ size_t IncrementalMarking::GetScheduledBytes(StepOrigin step_origin) {
 
 void IncrementalMarking::AdvanceAndFinalizeIfComplete() {
   const size_t max_bytes_to_process = GetScheduledBytes(StepOrigin::kTask);
-  Step(GetMaxDuration(StepOrigin::kTask), max_bytes_to_process,
+  Step(GetMaxDuration(heap(), StepOrigin::kTask), max_bytes_to_process,
        StepOrigin::kTask);
   if (IsMajorMarkingComplete()) {
     heap()->FinalizeIncrementalMarkingAtomically(
@@ -748,7 +756,8 @@ void IncrementalMarking::AdvanceOnAllocation() {
   DCHECK(IsMajorMarking());
 
   const size_t max_bytes_to_process = GetScheduledBytes(StepOrigin::kV8);
-  Step(GetMaxDuration(StepOrigin::kV8), max_bytes_to_process, StepOrigin::kV8);
+  Step(GetMaxDuration(heap(), StepOrigin::kV8), max_bytes_to_process,
+       StepOrigin::kV8);
 
   // Bail out when an AlwaysAllocateScope is active as the assumption is that
   // there's no GC being triggered. Check this condition at last position to
@@ -329,6 +329,8 @@ bool MarkCompactCollector::StartCompaction(StartCompactionMode mode) {
     return false;
   }
 
+  evacuation_budget_bytes_ = ComputeEvacuationBudget();
+
   CollectEvacuationCandidates(heap_->old_space());
 
   if (heap_->shared_space()) {
@@ -546,6 +548,29 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
   }
 }
 
+size_t MarkCompactCollector::ComputeEvacuationBudget() {
+  // Memory reducing GCs trade pause time for a smaller heap.
+  if (v8_flags.compaction_pause_budget_ms <= 0 ||
+      heap_->ShouldReduceMemory()) {
+    return std::numeric_limits<size_t>::max();
+  }
+  // Without compaction speed samples the fixed limits of
+  // ComputeEvacuationHeuristics() apply.
+  const double compaction_speed =
+      heap_->tracer()->CompactionSpeedInBytesPerMillisecond();
+  if (compaction_speed == 0) return std::numeric_limits<size_t>::max();
+  // Candidates are evacuated in parallel, each task at the traced speed. Pages
+  // that don't fit into the budget stay fragmented until a later GC, which
+  // again starts with the most fragmented pages.
+  const double budget = compaction_speed *
+                        NumberOfParallelCompactionTasks(heap_) *
+                        v8_flags.compaction_pause_budget_ms;
+  if (budget >= static_cast<double>(std::numeric_limits<size_t>::max())) {
+    return std::numeric_limits<size_t>::max();
+  }
+  return static_cast<size_t>(budget);
+}
+
 void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
   DCHECK(space->identity() == OLD_SPACE || space->identity() == CODE_SPACE ||
          space->identity() == SHARED_SPACE ||
@@ -572,6 +597,8 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     //   compacted.
     ComputeEvacuationHeuristics(area_size, &target_fragmentation_percent,
                                 &max_evacuated_bytes);
+    max_evacuated_bytes =
+        std::min(max_evacuated_bytes, evacuation_budget_bytes_);
     free_bytes_threshold = target_fragmentation_percent * (area_size / 100);
   }
 
@@ -691,14 +718,18 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     for (int i = 0; i < candidate_count; i++) {
       AddEvacuationCandidate(pages[i].second);
     }
+    if (candidate_count > 0) {
+      evacuation_budget_bytes_ -=
+          std::min(total_live_bytes, evacuation_budget_bytes_);
+    }
   }
 
   if (v8_flags.trace_fragmentation) {
     PrintIsolate(heap_->isolate(),
                  "compaction-selection: space=%s reduce_memory=%d pages=%d "
-                 "total_live_bytes=%zu\n",
+                 "total_live_bytes=%zu remaining_budget_kb=%zu\n",
                  ToString(space->identity()), reduce_memory, candidate_count,
-                 total_live_bytes / KB);
+                 total_live_bytes / KB, evacuation_budget_bytes_ / KB);
   }
 }
 
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_MARK_COMPACT_H_
 #define V8_HEAP_MARK_COMPACT_H_
 
+#include <limits>
 #include <vector>
 
 #include "include/v8-internal.h"
@@ -202,6 +203,9 @@ class MarkCompactCollector final {
   void ComputeEvacuationHeuristics(size_t area_size,
                                    int* target_fragmentation_percent,
                                    size_t* max_evacuated_bytes);
+  // Returns how many live bytes can be evacuated from the evacuation
+  // candidates of all spaces within --compaction-pause-budget-ms.
+  size_t ComputeEvacuationBudget();
 
   void RecordObjectStats();
 
@@ -420,6 +424,9 @@ class MarkCompactCollector final {
   std::vector<GlobalHandleVector<DescriptorArray>> strong_descriptor_arrays_;
   base::Mutex strong_descriptor_arrays_mutex_;
 
+  // Live bytes that may still be selected for evacuation in this cycle. Shared
+  // by all compacted spaces.
+  size_t evacuation_budget_bytes_ = std::numeric_limits<size_t>::max();
   // Candidates for pages that should be evacuated.
   std::vector<PageMetadata*> evacuation_candidates_;
   // Pages that are actually processed during evacuation.
@@ -0,0 +1,61 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/parallel-gc-scheduler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "include/v8-platform.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/logging.h"
+#include "src/init/v8.h"
+
+namespace v8 {
+namespace internal {
+
+ParallelGCScheduler::Scope::Scope(ParallelGCScheduler* scheduler,
+                                  uint64_t pause_cost)
+    : scheduler_(scheduler), pause_cost_(std::max<uint64_t>(pause_cost, 1)) {
+  scheduler_->active_jobs_.fetch_add(1, std::memory_order_relaxed);
+  scheduler_->total_pause_cost_.fetch_add(pause_cost_,
+                                          std::memory_order_relaxed);
+}
+
+ParallelGCScheduler::Scope::~Scope() {
+  scheduler_->total_pause_cost_.fetch_sub(pause_cost_,
+                                          std::memory_order_relaxed);
+  scheduler_->active_jobs_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+size_t ParallelGCScheduler::Scope::MaxConcurrency(
+    size_t wanted_num_workers) const {
+  return std::min(wanted_num_workers, scheduler_->ShareOf(pause_cost_));
+}
+
+ParallelGCScheduler::ParallelGCScheduler(size_t num_threads)
+    : num_threads_(num_threads) {
+  DCHECK_LT(0, num_threads_);
+}
+
+size_t ParallelGCScheduler::ShareOf(uint64_t pause_cost) const {
+  if (active_jobs_.load(std::memory_order_relaxed) <= 1) return num_threads_;
+  const uint64_t total_pause_cost =
+      total_pause_cost_.load(std::memory_order_relaxed);
+  // The counters are updated separately, so the job may not be accounted yet.
+  if (total_pause_cost <= pause_cost) return num_threads_;
+  // Round up so that the shares use all threads. The joining threads always
+  // take part, so every job gets at least one.
+  const double share = static_cast<double>(num_threads_) * pause_cost /
+                       static_cast<double>(total_pause_cost);
+  return std::clamp<size_t>(static_cast<size_t>(std::ceil(share)), 1,
+                            num_threads_);
+}
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(
+    ParallelGCScheduler, GetProcessWideParallelGCScheduler,
+    V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1)
+
+}  // namespace internal
+}  // namespace v8
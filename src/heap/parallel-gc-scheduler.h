@@ -0,0 +1,72 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_PARALLEL_GC_SCHEDULER_H_
+#define V8_HEAP_PARALLEL_GC_SCHEDULER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+// Balances the worker threads of the platform between parallel GC jobs of
+// different isolates that run at the same time.
+//
+// The platform only sees each job's own maximum concurrency, so with many
+// isolates collecting at once every job asks for all workers and the pauses
+// of all isolates get long. Jobs that register here are instead capped at a
+// share of the workers that is proportional to their estimated pause time,
+// which keeps the pauses of the isolates with the most work short. A job that
+// runs alone is not limited.
+class V8_EXPORT_PRIVATE ParallelGCScheduler final {
+ public:
+  // Registers a job with the scheduler for the lifetime of the scope.
+  class V8_NODISCARD Scope final {
+   public:
+    // `pause_cost` is the estimated pause time in microseconds.
+    Scope(ParallelGCScheduler* scheduler, uint64_t pause_cost);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    // Caps the number of workers a job wants at its current share.
+    size_t MaxConcurrency(size_t wanted_num_workers) const;
+
+   private:
+    ParallelGCScheduler* const scheduler_;
+    const uint64_t pause_cost_;
+  };
+
+  // `num_threads` is the number of threads that jobs can run on, including
+  // the joining threads.
+  explicit ParallelGCScheduler(size_t num_threads);
+  ParallelGCScheduler(const ParallelGCScheduler&) = delete;
+  ParallelGCScheduler& operator=(const ParallelGCScheduler&) = delete;
+
+  // Returns the number of threads a job with the given pause cost should use,
+  // which is at least one.
+  size_t ShareOf(uint64_t pause_cost) const;
+
+  size_t active_jobs() const {
+    return active_jobs_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  const size_t num_threads_;
+  std::atomic<size_t> active_jobs_{0};
+  std::atomic<uint64_t> total_pause_cost_{0};
+};
+
+// Returns the scheduler that is shared by all isolates of the process. Must
+// only be called after the platform is initialized.
+V8_EXPORT_PRIVATE ParallelGCScheduler* GetProcessWideParallelGCScheduler();
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_PARALLEL_GC_SCHEDULER_H_
@@ -28,14 +28,14 @@ void PretenuringHandler::UpdateAllocationSite(
   DCHECK_IMPLIES(!v8_flags.minor_ms && !Heap::InYoungGeneration(object),
                  chunk->IsFlagSet(MemoryChunk::PAGE_NEW_OLD_PROMOTION));
 #endif
-  if (!v8_flags.allocation_site_pretenuring ||
-      !AllocationSite::CanTrack(map->instance_type())) {
+  if (!v8_flags.allocation_site_pretenuring) return;
+  if (!AllocationSite::CanTrack(map->instance_type()) &&
+      !IsTrackedRuntimeAllocation(map, object)) {
     return;
   }
   Tagged<AllocationMemento> memento_candidate =
       FindAllocationMemento<kForGC>(map, object);
   if (memento_candidate.is_null()) return;
-  DCHECK(IsJSObjectMap(map));
 
   // Entering cached feedback is used in the parallel case. We are not allowed
   // to dereference the allocation site and rather have to postpone all checks
@@ -44,6 +44,20 @@ void PretenuringHandler::UpdateAllocationSite(
   (*pretenuring_feedback)[UncheckedCast<AllocationSite>(Tagged<Object>(key))]++;
 }
 
+// static
+bool PretenuringHandler::IsTrackedRuntimeAllocation(
+    Tagged<Map> map, Tagged<HeapObject> object) {
+  switch (map->instance_type()) {
+    case SEQ_ONE_BYTE_STRING_TYPE:
+    case SEQ_TWO_BYTE_STRING_TYPE:
+    case FIXED_ARRAY_TYPE:
+    case FIXED_DOUBLE_ARRAY_TYPE:
+      return object->SizeFromMap(map) >= kMinRuntimeAllocationSiteObjectSize;
+    default:
+      return false;
+  }
+}
+
 template <PretenuringHandler::FindMementoMode mode>
 Tagged<AllocationMemento> PretenuringHandler::FindAllocationMemento(
     Tagged<Map> map, Tagged<HeapObject> object) {
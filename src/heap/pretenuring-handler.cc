@@ -8,6 +8,7 @@
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/handles/global-handles-inl.h"
+#include "src/heap/factory.h"
 #include "src/heap/gc-tracer-inl.h"
 #include "src/heap/new-spaces.h"
 #include "src/objects/allocation-site-inl.h"
@@ -289,7 +290,26 @@ void PretenuringHandler::PretenureAllocationSiteOnNextCollection(
   allocation_sites_to_pretenure_->Push(site);
 }
 
-void PretenuringHandler::reset() { allocation_sites_to_pretenure_.reset(); }
+Handle<AllocationSite> PretenuringHandler::GetRuntimeAllocationSite(
+    RuntimeAllocationSite site) {
+  if (!runtime_allocation_sites_) {
+    // The vector is a strong root while the sites are allocated.
+    auto sites = std::make_unique<GlobalHandleVector<AllocationSite>>(heap_);
+    sites->Reserve(kRuntimeAllocationSiteCount);
+    for (int i = 0; i < kRuntimeAllocationSiteCount; i++) {
+      sites->Push(*heap_->isolate()->factory()->NewAllocationSite(true));
+    }
+    runtime_allocation_sites_ = std::move(sites);
+  }
+  const size_t index = static_cast<size_t>(site);
+  DCHECK_LT(index, runtime_allocation_sites_->size());
+  return (*runtime_allocation_sites_)[index];
+}
+
+void PretenuringHandler::reset() {
+  allocation_sites_to_pretenure_.reset();
+  runtime_allocation_sites_.reset();
+}
 
 }  // namespace internal
 }  // namespace v8
@@ -18,9 +18,23 @@ template <typename T>
 class GlobalHandleVector;
 class Heap;
 
+// Runtime paths that allocate backing stores without an AllocationSite of
+// their own. Each of them collects pretenuring feedback for its large backing
+// stores through an AllocationSite owned by the PretenuringHandler.
+enum class RuntimeAllocationSite : uint8_t {
+  kStringConcatenation,
+  kStringBuilder,
+  kArrayGrowth,
+  kJsonParse,
+};
+
 class PretenuringHandler final {
  public:
   static constexpr int kInitialFeedbackCapacity = 256;
+  static constexpr int kRuntimeAllocationSiteCount = 4;
+  // Backing stores allocated for a RuntimeAllocationSite are only tracked from
+  // this size on. Smaller ones are cheap to copy and not worth a memento.
+  static constexpr int kMinRuntimeAllocationSiteObjectSize = 4 * KB;
 
   using PretenuringFeedbackMap =
       std::unordered_map<Tagged<AllocationSite>, size_t, Object::Hasher>;
@@ -47,12 +61,22 @@ class PretenuringHandler final {
       Tagged<Map> map, Tagged<HeapObject> object,
       PretenuringFeedbackMap* pretenuring_feedback);
 
+  // Whether `object` may be a backing store allocated for a
+  // RuntimeAllocationSite and thus be followed by a memento.
+  static inline bool IsTrackedRuntimeAllocation(Tagged<Map> map,
+                                                Tagged<HeapObject> object);
+
   // Merges local pretenuring feedback into the global one. Note that this
   // method needs to be called after evacuation, as allocation sites may be
   // evacuated and this method resolves forward pointers accordingly.
   void MergeAllocationSitePretenuringFeedback(
       const PretenuringFeedbackMap& local_pretenuring_feedback);
 
+  // Returns the AllocationSite collecting feedback for the backing stores
+  // allocated by `site`.
+  V8_EXPORT_PRIVATE Handle<AllocationSite> GetRuntimeAllocationSite(
+      RuntimeAllocationSite site);
+
   // Adds an allocation site to the list of sites to be pretenured during the
   // next collection. Added allocation sites are pretenured independent of
   // their feedback.
@@ -89,6 +113,10 @@ class PretenuringHandler final {
 
   std::unique_ptr<GlobalHandleVector<AllocationSite>>
       allocation_sites_to_pretenure_;
+
+  // Indexed by RuntimeAllocationSite, created on first use.
+  std::unique_ptr<GlobalHandleVector<AllocationSite>>
+      runtime_allocation_sites_;
 };
 
 }  // namespace internal
@@ -224,7 +224,8 @@ ScavengerCollector::JobTask::JobTask(
     std::vector<std::pair<ParallelWorkItem, MutablePageMetadata*>>
         memory_chunks,
     Scavenger::CopiedList* copied_list,
-    Scavenger::PromotionList* promotion_list)
+    Scavenger::PromotionList* promotion_list,
+    const ParallelGCScheduler::Scope* scheduler_scope)
     : outer_(outer),
       scavengers_(scavengers),
       memory_chunks_(std::move(memory_chunks)),
@@ -232,6 +233,7 @@ ScavengerCollector::JobTask::JobTask(
       generator_(memory_chunks_.size()),
       copied_list_(copied_list),
       promotion_list_(promotion_list),
+      scheduler_scope_(scheduler_scope),
       trace_id_(
           reinterpret_cast<uint64_t>(this) ^
           outer_->heap_->tracer()->CurrentEpoch(GCTracer::Scope::SCAVENGER)) {}
@@ -270,7 +272,12 @@ size_t ScavengerCollector::JobTask::GetMaxConcurrency(
       outer_->heap_->ShouldOptimizeForBattery()) {
     return std::min<size_t>(wanted_num_workers, 1);
   }
-  return std::min<size_t>(scavengers_->size(), wanted_num_workers);
+  wanted_num_workers =
+      std::min<size_t>(scavengers_->size(), wanted_num_workers);
+  if (scheduler_scope_) {
+    return scheduler_scope_->MaxConcurrency(wanted_num_workers);
+  }
+  return wanted_num_workers;
 }
 
 void ScavengerCollector::JobTask::ProcessItems(JobDelegate* delegate,
@@ -367,6 +374,7 @@ class V8_NODISCARD ScopedFullHeapCrashKey {
 void ScavengerCollector::CollectGarbage() {
   ScopedFullHeapCrashKey collect_full_heap_dump_if_crash(isolate_);
 
+  const uint64_t pause_cost = EstimatePauseCost();
   auto* new_space = SemiSpaceNewSpace::From(heap_->new_space());
   new_space->GarbageCollectionPrologue();
   new_space->EvacuatePrologue();
@@ -438,9 +446,14 @@ void ScavengerCollector::CollectGarbage() {
       TRACE_GC_ARG1(
           heap_->tracer(), GCTracer::Scope::SCAVENGER_SCAVENGE_PARALLEL_PHASE,
           "UseBackgroundThreads", heap_->ShouldUseBackgroundThreads());
-      auto job =
-          std::make_unique<JobTask>(this, &scavengers, std::move(memory_chunks),
-                                    &copied_list, &promotion_list);
+      std::optional<ParallelGCScheduler::Scope> scheduler_scope;
+      if (v8_flags.parallel_scavenge_scheduling) {
+        scheduler_scope.emplace(GetProcessWideParallelGCScheduler(),
+                                pause_cost);
+      }
+      auto job = std::make_unique<JobTask>(
+          this, &scavengers, std::move(memory_chunks), &copied_list,
+          &promotion_list, scheduler_scope ? &*scheduler_scope : nullptr);
       TRACE_GC_NOTE_WITH_FLOW("Parallel scavenge started", job->trace_id(),
                               TRACE_EVENT_FLAG_FLOW_OUT);
       V8::GetCurrentPlatform()
@@ -668,6 +681,17 @@ int ScavengerCollector::NumberOfScavengeTasks() {
   return tasks;
 }
 
+uint64_t ScavengerCollector::EstimatePauseCost() const {
+  const size_t young_size =
+      heap_->new_space()->Size() + heap_->new_lo_space()->SizeOfObjects();
+  const double speed =
+      heap_->tracer()->YoungGenerationSpeedInBytesPerMillisecond(
+          YoungGenerationSpeedMode::kOnlyAtomicPause);
+  // Assume 1MB/ms until the speed has been measured.
+  if (speed == 0) return young_size / KB;
+  return static_cast<uint64_t>(young_size / speed * 1000);
+}
+
 Scavenger::PromotionList::Local::Local(Scavenger::PromotionList* promotion_list)
     : regular_object_promotion_list_local_(
           promotion_list->regular_object_promotion_list_),
@@ -12,6 +12,7 @@
 #include "src/heap/index-generator.h"
 #include "src/heap/mutable-page-metadata.h"
 #include "src/heap/objects-visiting.h"
+#include "src/heap/parallel-gc-scheduler.h"
 #include "src/heap/parallel-work-item.h"
 #include "src/heap/pretenuring-handler.h"
 #include "src/heap/slot-set.h"
@@ -265,7 +266,8 @@ class ScavengerCollector {
         std::vector<std::pair<ParallelWorkItem, MutablePageMetadata*>>
             memory_chunks,
         Scavenger::CopiedList* copied_list,
-        Scavenger::PromotionList* promotion_list);
+        Scavenger::PromotionList* promotion_list,
+        const ParallelGCScheduler::Scope* scheduler_scope);
 
     void Run(JobDelegate* delegate) override;
     size_t GetMaxConcurrency(size_t worker_count) const override;
@@ -287,6 +289,9 @@ class ScavengerCollector {
     Scavenger::CopiedList* copied_list_;
     Scavenger::PromotionList* promotion_list_;
 
+    // Set if the job shares the workers with the scavenges of other isolates.
+    const ParallelGCScheduler::Scope* const scheduler_scope_;
+
     const uint64_t trace_id_;
   };
 
@@ -294,6 +299,8 @@ class ScavengerCollector {
       const SurvivingNewLargeObjectsMap& objects);
 
   int NumberOfScavengeTasks();
+  // Estimates the pause time of the current scavenge in microseconds.
+  uint64_t EstimatePauseCost() const;
 
   void ProcessWeakReferences(
       EphemeronRememberedSet::TableList* ephemeron_table_list);
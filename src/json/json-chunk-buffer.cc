@@ -0,0 +1,139 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-chunk-buffer.h"
+
+#include <algorithm>
+
+#include "include/v8-primitive.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/strings/unicode-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// External string resource that takes ownership of the decoded characters.
+template <typename Char, typename Base>
+class VectorStringResource final : public Base {
+ public:
+  explicit VectorStringResource(std::vector<Char> chars)
+      : chars_(std::move(chars)) {}
+
+  const Char* data() const override { return chars_.data(); }
+
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  const std::vector<Char> chars_;
+};
+
+using VectorOneByteStringResource =
+    VectorStringResource<char, v8::String::ExternalOneByteStringResource>;
+using VectorTwoByteStringResource =
+    VectorStringResource<base::uc16, v8::String::ExternalStringResource>;
+
+}  // namespace
+
+JsonChunkBuffer::JsonChunkBuffer(bool is_utf8, size_t expected_length)
+    : is_utf8_(is_utf8), expected_length_(expected_length) {
+  Reset();
+}
+
+void JsonChunkBuffer::Append(const uint8_t* data, size_t length) {
+  if (is_utf8_) return AppendUtf8(data, length);
+  one_byte_chars_.insert(one_byte_chars_.end(), data, data + length);
+}
+
+void JsonChunkBuffer::AppendUtf8(const uint8_t* data, size_t length) {
+  const uint8_t* cursor = data;
+  const uint8_t* end = data + length;
+  while (cursor < end) {
+    // Copy runs of ASCII characters in bulk.
+    if (utf8_state_ == unibrow::Utf8::State::kAccept) {
+      const uint8_t* ascii_end = std::find_if(cursor, end, [](uint8_t c) {
+        return c > unibrow::Utf8::kMaxOneByteChar;
+      });
+      if (is_one_byte_) {
+        one_byte_chars_.insert(one_byte_chars_.end(), cursor, ascii_end);
+      } else {
+        two_byte_chars_.insert(two_byte_chars_.end(), cursor, ascii_end);
+      }
+      cursor = ascii_end;
+      if (cursor == end) break;
+    }
+    unibrow::uchar c =
+        unibrow::Utf8::ValueOfIncremental(&cursor, &utf8_state_, &utf8_buffer_);
+    if (c != unibrow::Utf8::kIncomplete) AddCharacter(c);
+  }
+}
+
+void JsonChunkBuffer::AddCharacter(base::uc32 c) {
+  if (is_one_byte_) {
+    if (V8_LIKELY(c <= unibrow::Latin1::kMaxChar)) {
+      one_byte_chars_.push_back(static_cast<char>(c));
+      return;
+    }
+    ConvertToTwoByte();
+  }
+  if (c > static_cast<base::uc32>(unibrow::Utf16::kMaxNonSurrogateCharCode)) {
+    two_byte_chars_.push_back(unibrow::Utf16::LeadSurrogate(c));
+    two_byte_chars_.push_back(unibrow::Utf16::TrailSurrogate(c));
+  } else {
+    two_byte_chars_.push_back(static_cast<base::uc16>(c));
+  }
+}
+
+void JsonChunkBuffer::ConvertToTwoByte() {
+  DCHECK(is_one_byte_);
+  two_byte_chars_.reserve(
+      std::max(expected_length_, one_byte_chars_.size() * 2));
+  for (char c : one_byte_chars_) {
+    two_byte_chars_.push_back(static_cast<uint8_t>(c));
+  }
+  std::vector<char>().swap(one_byte_chars_);
+  is_one_byte_ = false;
+}
+
+void JsonChunkBuffer::Reset() {
+  is_one_byte_ = true;
+  utf8_state_ = unibrow::Utf8::State::kAccept;
+  utf8_buffer_ = 0;
+  // The vectors may have been moved into a string resource by Finish(), so
+  // bring them back into a known state and size the buffer for the next input.
+  one_byte_chars_.clear();
+  two_byte_chars_.clear();
+  one_byte_chars_.reserve(expected_length_);
+}
+
+MaybeHandle<String> JsonChunkBuffer::Finish(Isolate* isolate) {
+  if (is_utf8_) {
+    unibrow::uchar c = unibrow::Utf8::ValueOfIncrementalFinish(&utf8_state_);
+    if (c != unibrow::Utf8::kBufferEmpty) AddCharacter(c);
+  }
+
+  Factory* factory = isolate->factory();
+  MaybeHandle<String> result;
+  if (is_one_byte_ ? one_byte_chars_.empty() : two_byte_chars_.empty()) {
+    // The factory does not take ownership of empty resources.
+    result = factory->empty_string();
+  } else if (is_one_byte_) {
+    auto* resource =
+        new VectorOneByteStringResource(std::move(one_byte_chars_));
+    result = factory->NewExternalStringFromOneByte(resource);
+    if (result.is_null()) delete resource;
+  } else {
+    auto* resource =
+        new VectorTwoByteStringResource(std::move(two_byte_chars_));
+    result = factory->NewExternalStringFromTwoByte(resource);
+    if (result.is_null()) delete resource;
+  }
+  Reset();
+  return result;
+}
+
+}  // namespace internal
+}  // namespace v8
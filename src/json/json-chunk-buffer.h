@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_CHUNK_BUFFER_H_
+#define V8_JSON_JSON_CHUNK_BUFFER_H_
+
+#include <vector>
+
+#include "src/base/strings.h"
+#include "src/handles/maybe-handles.h"
+#include "src/strings/unicode.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class String;
+
+// Backing store of v8::JSON::ChunkBuffer. Decodes chunks of Latin-1 or UTF-8
+// input into one-byte characters, switching to two-byte characters once a
+// character outside of Latin-1 shows up. The decoded characters are then
+// handed over to an external string without copying them again.
+//
+// Appending does not touch the heap, so chunks may be appended on any thread.
+// Nothing is parsed here; the caller parses the string returned by Finish().
+class JsonChunkBuffer final {
+ public:
+  JsonChunkBuffer(bool is_utf8, size_t expected_length);
+
+  JsonChunkBuffer(const JsonChunkBuffer&) = delete;
+  JsonChunkBuffer& operator=(const JsonChunkBuffer&) = delete;
+
+  void Append(const uint8_t* data, size_t length);
+
+  // Moves the characters appended so far into a new external string and
+  // resets the buffer. Throws if the string would be too long.
+  V8_WARN_UNUSED_RESULT MaybeHandle<String> Finish(Isolate* isolate);
+
+ private:
+  void AppendUtf8(const uint8_t* data, size_t length);
+  void AddCharacter(base::uc32 c);
+  void ConvertToTwoByte();
+  void Reset();
+
+  const bool is_utf8_;
+  const size_t expected_length_;
+  bool is_one_byte_ = true;
+  unibrow::Utf8::State utf8_state_ = unibrow::Utf8::State::kAccept;
+  unibrow::Utf8::Utf8IncrementalBuffer utf8_buffer_ = 0;
+  std::vector<char> one_byte_chars_;
+  std::vector<base::uc16> two_byte_chars_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_CHUNK_BUFFER_H_
@@ -26,6 +26,16 @@
 #include "src/strings/string-hasher.h"
 #include "src/utils/boxed-float.h"
 
+#if defined(V8_HOST_ARCH_X64) || \
+    (defined(V8_HOST_ARCH_IA32) && defined(__SSE2__))
+#define JSON_SCAN_SSE2
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+// Neon is guaranteed to be available on 64-bit ARM.
+#define JSON_SCAN_NEON
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -126,6 +136,185 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// The vectorized scanners below only ever look at whole vectors that lie
+// between |cursor| and |end|; whatever is left over (and, for two-byte input,
+// the vector that contains the first interesting character) is handed back to
+// the scalar loops in JsonParser, which stay the reference implementation.
+#if defined(JSON_SCAN_SSE2)
+
+// Returns the position of the first '"', '\\' or control character at or
+// after |cursor|, or the position at which the scalar loop has to resume.
+// For two-byte input, |bits| accumulates the bits of all skipped characters.
+V8_INLINE const uint8_t* ScanJsonStringBody(const uint8_t* cursor,
+                                            const uint8_t* end,
+                                            base::uc32* bits) {
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i max_control = _mm_set1_epi8(0x1F);
+  while (end - cursor >= 16) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i terminators = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chars, quote),
+                     _mm_cmpeq_epi8(chars, backslash)),
+        // chars <= 0x1F (unsigned) iff min(chars, 0x1F) == chars.
+        _mm_cmpeq_epi8(_mm_min_epu8(chars, max_control), chars));
+    int mask = _mm_movemask_epi8(terminators);
+    if (mask != 0) return cursor + base::bits::CountTrailingZeros32(mask);
+    cursor += 16;
+  }
+  return cursor;
+}
+
+V8_INLINE const uint16_t* ScanJsonStringBody(const uint16_t* cursor,
+                                             const uint16_t* end,
+                                             base::uc32* bits) {
+  const __m128i quote = _mm_set1_epi16('"');
+  const __m128i backslash = _mm_set1_epi16('\\');
+  const __m128i max_control = _mm_set1_epi16(0x1F);
+  const __m128i zero = _mm_setzero_si128();
+  __m128i seen = zero;
+  while (end - cursor >= 8) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i terminators = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(chars, quote),
+                     _mm_cmpeq_epi16(chars, backslash)),
+        // chars <= 0x1F (unsigned) iff saturating chars - 0x1F is zero.
+        _mm_cmpeq_epi16(_mm_subs_epu16(chars, max_control), zero));
+    if (_mm_movemask_epi8(terminators) != 0) break;
+    seen = _mm_or_si128(seen, chars);
+    cursor += 8;
+  }
+  // Only the high byte of each lane matters for the one-byte conversion check.
+  __m128i high_bytes = _mm_srli_epi16(seen, 8);
+  if (_mm_movemask_epi8(_mm_cmpeq_epi16(high_bytes, zero)) != 0xFFFF) {
+    *bits |= unibrow::Latin1::kMaxChar + 1;
+  }
+  return cursor;
+}
+
+// Returns the position of the first non-whitespace character at or after
+// |cursor|, or the position at which the scalar loop has to resume.
+template <typename Char>
+V8_INLINE const Char* SkipJsonWhitespace(const Char* cursor, const Char* end) {
+  constexpr int kCharsPerVector = 16 / sizeof(Char);
+  auto splat = [](char c) {
+    return sizeof(Char) == 1 ? _mm_set1_epi8(c) : _mm_set1_epi16(c);
+  };
+  auto equals = [](__m128i a, __m128i b) {
+    return sizeof(Char) == 1 ? _mm_cmpeq_epi8(a, b) : _mm_cmpeq_epi16(a, b);
+  };
+  const __m128i space = splat(' ');
+  const __m128i tab = splat('\t');
+  const __m128i cr = splat('\r');
+  const __m128i lf = splat('\n');
+  while (end - cursor >= kCharsPerVector) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i whitespace =
+        _mm_or_si128(_mm_or_si128(equals(chars, space), equals(chars, tab)),
+                     _mm_or_si128(equals(chars, cr), equals(chars, lf)));
+    uint32_t mask = ~_mm_movemask_epi8(whitespace) & 0xFFFF;
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros32(mask) / sizeof(Char);
+    }
+    cursor += kCharsPerVector;
+  }
+  return cursor;
+}
+
+#elif defined(JSON_SCAN_NEON)
+
+// Returns a 64-bit mask with 4 bits per byte lane of |v|, which must contain
+// only 0x00 or 0xFF lanes. This is the Neon equivalent of a movemask.
+V8_INLINE uint64_t NarrowLaneMask(uint8x16_t v) {
+  return vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+}
+
+V8_INLINE const uint8_t* ScanJsonStringBody(const uint8_t* cursor,
+                                            const uint8_t* end,
+                                            base::uc32* bits) {
+  const uint8x16_t quote = vdupq_n_u8('"');
+  const uint8x16_t backslash = vdupq_n_u8('\\');
+  const uint8x16_t first_non_control = vdupq_n_u8(0x20);
+  while (end - cursor >= 16) {
+    uint8x16_t chars = vld1q_u8(cursor);
+    uint8x16_t terminators =
+        vorrq_u8(vorrq_u8(vceqq_u8(chars, quote), vceqq_u8(chars, backslash)),
+                 vcltq_u8(chars, first_non_control));
+    if (vmaxvq_u8(terminators) != 0) {
+      return cursor +
+             base::bits::CountTrailingZeros64(NarrowLaneMask(terminators)) / 4;
+    }
+    cursor += 16;
+  }
+  return cursor;
+}
+
+V8_INLINE const uint16_t* ScanJsonStringBody(const uint16_t* cursor,
+                                             const uint16_t* end,
+                                             base::uc32* bits) {
+  const uint16x8_t quote = vdupq_n_u16('"');
+  const uint16x8_t backslash = vdupq_n_u16('\\');
+  const uint16x8_t first_non_control = vdupq_n_u16(0x20);
+  uint16x8_t seen = vdupq_n_u16(0);
+  while (end - cursor >= 8) {
+    uint16x8_t chars = vld1q_u16(cursor);
+    uint16x8_t terminators = vorrq_u16(
+        vorrq_u16(vceqq_u16(chars, quote), vceqq_u16(chars, backslash)),
+        vcltq_u16(chars, first_non_control));
+    if (vmaxvq_u16(terminators) != 0) break;
+    seen = vorrq_u16(seen, chars);
+    cursor += 8;
+  }
+  *bits |= vmaxvq_u16(seen) & ~unibrow::Latin1::kMaxChar;
+  return cursor;
+}
+
+template <typename Char>
+V8_INLINE const Char* SkipJsonWhitespace(const Char* cursor, const Char* end) {
+  constexpr int kCharsPerVector = 16 / sizeof(Char);
+  while (end - cursor >= kCharsPerVector) {
+    uint8x16_t whitespace;
+    if constexpr (sizeof(Char) == 1) {
+      uint8x16_t chars = vld1q_u8(cursor);
+      whitespace = vorrq_u8(
+          vorrq_u8(vceqq_u8(chars, vdupq_n_u8(' ')),
+                   vceqq_u8(chars, vdupq_n_u8('\t'))),
+          vorrq_u8(vceqq_u8(chars, vdupq_n_u8('\r')),
+                   vceqq_u8(chars, vdupq_n_u8('\n'))));
+    } else {
+      uint16x8_t chars = vld1q_u16(cursor);
+      whitespace = vreinterpretq_u8_u16(vorrq_u16(
+          vorrq_u16(vceqq_u16(chars, vdupq_n_u16(' ')),
+                    vceqq_u16(chars, vdupq_n_u16('\t'))),
+          vorrq_u16(vceqq_u16(chars, vdupq_n_u16('\r')),
+                    vceqq_u16(chars, vdupq_n_u16('\n')))));
+    }
+    uint64_t mask = ~NarrowLaneMask(whitespace);
+    if (mask != 0) {
+      return cursor +
+             base::bits::CountTrailingZeros64(mask) / (4 * sizeof(Char));
+    }
+    cursor += kCharsPerVector;
+  }
+  return cursor;
+}
+
+#else
+
+template <typename Char>
+V8_INLINE const Char* ScanJsonStringBody(const Char* cursor, const Char* end,
+                                         base::uc32* bits) {
+  return cursor;
+}
+
+template <typename Char>
+V8_INLINE const Char* SkipJsonWhitespace(const Char* cursor, const Char* end) {
+  return cursor;
+}
+
+#endif  // defined(JSON_SCAN_SSE2)
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
@@ -561,6 +750,13 @@ template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   JsonToken local_next = JsonToken::EOS;
 
+  // Skip runs of indentation in pretty-printed input a vector at a time; in
+  // minified input we are usually already looking at the next token.
+  if (V8_LIKELY(!is_at_end()) &&
+      GetTokenForCharacter(*cursor_) == JsonToken::WHITESPACE) {
+    cursor_ = SkipJsonWhitespace(cursor_, end_);
+  }
+
   cursor_ = std::find_if(cursor_, end_, [&](Char c) {
     JsonToken current = GetTokenForCharacter(c);
     bool result = current != JsonToken::WHITESPACE;
@@ -1311,8 +1507,8 @@ Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
       elements_kind = DICTIONARY_ELEMENTS;
       elements = elms;
     } else {
-      Handle<FixedArray> elms =
-          factory()->NewFixedArrayWithHoles(cont.max_index + 1);
+      Handle<FixedArray> elms = factory()->NewFixedArrayWithHoles(
+          cont.max_index + 1, RuntimeAllocationSite::kJsonParse);
       DisallowGarbageCollection no_gc;
       Tagged<FixedArray> raw_elements = *elms;
       WriteBarrierMode mode = raw_elements->GetWriteBarrierMode(no_gc);
@@ -1357,25 +1553,28 @@ Handle<Object> JsonParser<Char>::BuildJsonArray(size_t start) {
     }
   }
 
-  Handle<JSArray> array = factory()->NewJSArray(kind, length, length);
+  Handle<FixedArrayBase> elements;
   if (kind == PACKED_DOUBLE_ELEMENTS) {
+    elements = factory()->NewFixedDoubleArray(
+        length, RuntimeAllocationSite::kJsonParse);
     DisallowGarbageCollection no_gc;
-    Tagged<FixedDoubleArray> elements =
-        Cast<FixedDoubleArray>(array->elements());
+    Tagged<FixedDoubleArray> raw_elements = Cast<FixedDoubleArray>(*elements);
     for (int i = 0; i < length; i++) {
-      elements->set(i, Object::NumberValue(*element_stack_[start + i]));
+      raw_elements->set(i, Object::NumberValue(*element_stack_[start + i]));
     }
   } else {
+    elements = factory()->NewFixedArrayWithHoles(
+        length, RuntimeAllocationSite::kJsonParse);
     DisallowGarbageCollection no_gc;
-    Tagged<FixedArray> elements = Cast<FixedArray>(array->elements());
+    Tagged<FixedArray> raw_elements = Cast<FixedArray>(*elements);
     WriteBarrierMode mode = kind == PACKED_SMI_ELEMENTS
                                 ? SKIP_WRITE_BARRIER
-                                : elements->GetWriteBarrierMode(no_gc);
+                                : raw_elements->GetWriteBarrierMode(no_gc);
     for (int i = 0; i < length; i++) {
-      elements->set(i, *element_stack_[start + i], mode);
+      raw_elements->set(i, *element_stack_[start + i], mode);
     }
   }
-  return array;
+  return factory()->NewJSArrayWithElements(elements, kind, length);
 }
 
 // Parse rawJSON value.
@@ -2029,12 +2228,18 @@ Handle<String> JsonParser<Char>::MakeString(const JsonString& string,
   if (sizeof(Char) == 1 ? V8_LIKELY(!string.needs_conversion())
                         : string.needs_conversion()) {
     Handle<SeqOneByteString> intermediate =
-        factory()->NewRawOneByteString(string.length()).ToHandleChecked();
+        factory()
+            ->NewRawOneByteString(string.length(),
+                                  RuntimeAllocationSite::kJsonParse)
+            .ToHandleChecked();
     return DecodeString(string, intermediate, hint);
   }
 
   Handle<SeqTwoByteString> intermediate =
-      factory()->NewRawTwoByteString(string.length()).ToHandleChecked();
+      factory()
+          ->NewRawTwoByteString(string.length(),
+                                RuntimeAllocationSite::kJsonParse)
+          .ToHandleChecked();
   return DecodeString(string, intermediate, hint);
 }
 
@@ -2111,6 +2316,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    cursor_ = ScanJsonStringBody(cursor_, end_, &bits);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -2196,6 +2402,9 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   return JsonString();
 }
 
+#undef JSON_SCAN_SSE2
+#undef JSON_SCAN_NEON
+
 // Explicit instantiation.
 template class JsonParser<uint8_t>;
 template class JsonParser<uint16_t>;
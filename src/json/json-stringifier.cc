@@ -20,6 +20,8 @@
 #include "src/objects/smi.h"
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-decoder.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -38,9 +40,18 @@ class JsonStringifier {
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToUtf8(Handle<Object> object,
+                                                    Handle<Object> gap,
+                                                    v8::JSON::Utf8Sink* sink);
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION, NEED_STACK };
 
+  // Serializes |object| into the current part. The result is never
+  // NEED_STACK.
+  Result SerializeToPart(Handle<Object> object, Handle<Object> replacer,
+                         Handle<Object> gap);
+
   bool InitializeReplacer(Handle<Object> replacer);
   bool InitializeGap(Handle<Object> gap);
 
@@ -208,6 +219,11 @@ class JsonStringifier {
   V8_INLINE Result SerializeJSArray(Handle<JSArray> object, Handle<Object> key);
   V8_INLINE Result SerializeJSObject(Handle<JSObject> object,
                                      Handle<Object> key);
+  class ObjectLayout;
+  Result SerializeJSObjectWithLayout(Handle<JSObject> object,
+                                     Handle<Object> key,
+                                     DirectHandle<Map> map,
+                                     ObjectLayout* layout);
 
   Result SerializeJSProxy(Handle<JSProxy> object, Handle<Object> key);
   Result SerializeJSReceiverSlow(Handle<JSReceiver> object);
@@ -323,6 +339,118 @@ class JsonStringifier {
     Tagged_t keys_[kSize];
   };
 
+  class ObjectLayoutCache;
+
+  // The layout of the enumerable own properties of objects with a given map,
+  // for maps whose enumerable own properties are all data fields with simple
+  // keys (as in SimplePropertyKeyCache). Keys are stored pre-quoted and
+  // followed by a colon, so that objects of the same map only need to emit
+  // their values.
+  class ObjectLayout {
+   public:
+    struct Property {
+      InternalIndex descriptor;
+      FieldIndex field_index;
+      uint32_t key_start;
+      uint32_t key_length;
+    };
+
+    base::Vector<const uint8_t> key_fragment(const Property& property) const {
+      return base::Vector<const uint8_t>(
+          key_fragments_.data() + property.key_start, property.key_length);
+    }
+
+    const std::vector<Property>& properties() const { return properties_; }
+
+    // Keeps the layout from being replaced while values are serialized, since
+    // they may contain objects whose maps use the same cache slot.
+    class UseScope {
+     public:
+      explicit UseScope(ObjectLayout* layout) : layout_(layout) {
+        layout_->users_++;
+      }
+      ~UseScope() { layout_->users_--; }
+
+     private:
+      ObjectLayout* const layout_;
+    };
+
+   private:
+    friend class ObjectLayoutCache;
+
+    enum class State : uint8_t { kSeenOnce, kCacheable, kUncacheable };
+
+    bool Build(Tagged<Map> map, const DisallowGarbageCollection& no_gc);
+
+    Address map_ = kNullAddress;
+    State state_ = State::kSeenOnce;
+    // Number of active UseScopes.
+    int users_ = 0;
+    std::vector<Property> properties_;
+    std::vector<uint8_t> key_fragments_;
+  };
+
+  // A cache of object layouts by map, to speed up serializing many objects of
+  // the same shape, e.g. arrays of records. A layout is only built once a map
+  // is seen for the second time. Like SimplePropertyKeyCache, maps are
+  // referenced by address, so all entries are invalidated on GC. The layouts
+  // themselves are kept until their slot is reused.
+  class ObjectLayoutCache {
+   public:
+    explicit ObjectLayoutCache(Isolate* isolate) : isolate_(isolate) {}
+
+    ~ObjectLayoutCache() {
+      if (!callback_registered_) return;
+      isolate_->main_thread_local_heap()->RemoveGCEpilogueCallback(
+          UpdatePointersCallback, this);
+    }
+
+    // Returns the layout for |map|, or nullptr if there is none (yet).
+    ObjectLayout* Lookup(Tagged<Map> map) {
+      ObjectLayout* layout =
+          &layouts_[(map.ptr() >> kTaggedSizeLog2) & kIndexMask];
+      if (layout->map_ != map.ptr()) {
+        if (layout->users_ > 0) return nullptr;
+        if (!callback_registered_) {
+          isolate_->main_thread_local_heap()->AddGCEpilogueCallback(
+              UpdatePointersCallback, this);
+          callback_registered_ = true;
+        }
+        layout->map_ = map.ptr();
+        layout->state_ = ObjectLayout::State::kSeenOnce;
+        return nullptr;
+      }
+      if (layout->state_ == ObjectLayout::State::kSeenOnce) {
+        DCHECK_EQ(layout->users_, 0);
+        DisallowGarbageCollection no_gc;
+        layout->state_ = layout->Build(map, no_gc)
+                             ? ObjectLayout::State::kCacheable
+                             : ObjectLayout::State::kUncacheable;
+      }
+      return layout->state_ == ObjectLayout::State::kCacheable ? layout
+                                                               : nullptr;
+    }
+
+   private:
+    static void UpdatePointersCallback(void* cache) {
+      for (ObjectLayout& layout :
+           reinterpret_cast<ObjectLayoutCache*>(cache)->layouts_) {
+        layout.map_ = kNullAddress;
+      }
+    }
+
+    static constexpr size_t kSizeBits = 4;
+    static constexpr size_t kSize = 1 << kSizeBits;
+    static constexpr size_t kIndexMask = kSize - 1;
+
+    Isolate* isolate_;
+    bool callback_registered_ = false;
+    ObjectLayout layouts_[kSize];
+  };
+
+  // Appends the pre-quoted key of an ObjectLayout::Property.
+  V8_INLINE void AppendKeyFragment(base::Vector<const uint8_t> fragment);
+
   // Returns whether any escape sequences were used.
   template <typename SrcChar, typename DestChar, bool raw_json>
   V8_INLINE static bool SerializeStringUnchecked_(
@@ -391,6 +519,10 @@ class JsonStringifier {
   std::vector<KeyObject> stack_;
 
   SimplePropertyKeyCache key_cache_;
+  ObjectLayoutCache layout_cache_;
+  // Set while serializing a property whose key is taken from an ObjectLayout,
+  // and consumed by SerializeDeferredKey.
+  base::Vector<const uint8_t> pending_key_fragment_;
   uint8_t one_byte_array_[kInitialPartLength];
 
   static const int kJsonEscapeTableEntrySize = 8;
@@ -404,6 +536,12 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+Maybe<bool> JsonStringifyToUtf8(Isolate* isolate, Handle<Object> object,
+                                Handle<Object> gap, v8::JSON::Utf8Sink* sink) {
+  JsonStringifier stringifier(isolate);
+  return stringifier.StringifyToUtf8(object, gap, sink);
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -458,21 +596,91 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
       overflowed_(false),
       need_stack_(false),
       stack_(),
-      key_cache_(isolate) {
+      key_cache_(isolate),
+      layout_cache_(isolate) {
   one_byte_ptr_ = one_byte_array_;
   part_ptr_ = one_byte_ptr_;
 }
 
-MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
-                                               Handle<Object> replacer,
-                                               Handle<Object> gap) {
+namespace {
+
+// Encodes the characters of the current part as UTF-8 and passes them to a
+// v8::JSON::Utf8Sink in chunks. Long runs of ASCII characters in one-byte
+// parts are passed to the sink directly without copying them.
+class Utf8SinkWriter final {
+ public:
+  explicit Utf8SinkWriter(v8::JSON::Utf8Sink* sink) : sink_(sink) {}
+  ~Utf8SinkWriter() { Flush(); }
+
+  void Write(base::Vector<const uint8_t> chars) {
+    const uint8_t* cursor = chars.begin();
+    const uint8_t* end = chars.end();
+    while (cursor < end) {
+      size_t ascii_length = static_cast<size_t>(
+          NonAsciiStart(cursor, static_cast<int>(end - cursor)));
+      if (ascii_length >= kMinDirectWriteLength) {
+        Flush();
+        sink_->Write(reinterpret_cast<const char*>(cursor), ascii_length);
+      } else {
+        EnsureCapacity(ascii_length);
+        memcpy(buffer_ + length_, cursor, ascii_length);
+        length_ += ascii_length;
+      }
+      cursor += ascii_length;
+      if (cursor == end) break;
+      // NonAsciiStart may stop at the start of the word that contains the
+      // first non-ASCII character, so always make progress here.
+      do {
+        EnsureCapacity(unibrow::Utf8::kMax8BitCodeUnitSize);
+        length_ += unibrow::Utf8::EncodeOneByte(buffer_ + length_, *cursor++);
+      } while (cursor < end && *cursor > unibrow::Utf8::kMaxOneByteChar);
+    }
+  }
+
+  void Write(base::Vector<const base::uc16> chars) {
+    for (size_t i = 0; i < chars.size(); i++) {
+      unibrow::uchar c = chars[i];
+      if (unibrow::Utf16::IsLeadSurrogate(c) && i + 1 < chars.size() &&
+          unibrow::Utf16::IsTrailSurrogate(chars[i + 1])) {
+        c = unibrow::Utf16::CombineSurrogatePair(c, chars[++i]);
+      }
+      EnsureCapacity(unibrow::Utf8::kMaxEncodedSize);
+      length_ += unibrow::Utf8::Encode(buffer_ + length_, c,
+                                       unibrow::Utf16::kNoPreviousCharacter,
+                                       true);
+    }
+  }
+
+ private:
+  void EnsureCapacity(size_t length) {
+    if (length_ + length > kBufferSize) Flush();
+  }
+
+  void Flush() {
+    if (length_ == 0) return;
+    sink_->Write(buffer_, length_);
+    length_ = 0;
+  }
+
+  static constexpr size_t kBufferSize = 4096;
+  static constexpr size_t kMinDirectWriteLength = 256;
+
+  v8::JSON::Utf8Sink* const sink_;
+  size_t length_ = 0;
+  char buffer_[kBufferSize];
+};
+
+}  // namespace
+
+JsonStringifier::Result JsonStringifier::SerializeToPart(
+    Handle<Object> object, Handle<Object> replacer, Handle<Object> gap) {
   if (!InitializeReplacer(replacer)) {
     CHECK(isolate_->has_exception());
-    return MaybeHandle<Object>();
+    return EXCEPTION;
   }
   if (!IsUndefined(*gap, isolate_) && !InitializeGap(gap)) {
     CHECK(isolate_->has_exception());
-    return MaybeHandle<Object>();
+    return EXCEPTION;
   }
   Result result = SerializeObject(object);
   if (result == NEED_STACK) {
@@ -480,11 +688,21 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
     current_index_ = 0;
     result = SerializeObject(object);
   }
+  if (result == SUCCESS &&
+      (overflowed_ || current_index_ > String::kMaxLength)) {
+    isolate_->Throw(*factory()->NewInvalidStringLengthError());
+    return EXCEPTION;
+  }
+  DCHECK(result != EXCEPTION || isolate_->has_exception());
+  return result;
+}
+
+MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
+                                               Handle<Object> replacer,
+                                               Handle<Object> gap) {
+  Result result = SerializeToPart(object, replacer, gap);
   if (result == UNCHANGED) return factory()->undefined_value();
   if (result == SUCCESS) {
-    if (overflowed_ || current_index_ > String::kMaxLength) {
-      THROW_NEW_ERROR(isolate_, NewInvalidStringLengthError());
-    }
     if (encoding_ == String::ONE_BYTE_ENCODING) {
       return isolate_->factory()
           ->NewStringFromOneByte(base::OneByteVector(
@@ -500,6 +718,26 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   return MaybeHandle<Object>();
 }
 
+Maybe<bool> JsonStringifier::StringifyToUtf8(Handle<Object> object,
+                                             Handle<Object> gap,
+                                             v8::JSON::Utf8Sink* sink) {
+  Result result = SerializeToPart(object, factory()->undefined_value(), gap);
+  if (result == UNCHANGED) return Just(false);
+  if (result == SUCCESS) {
+    Utf8SinkWriter writer(sink);
+    if (encoding_ == String::ONE_BYTE_ENCODING) {
+      writer.Write(base::Vector<const uint8_t>(one_byte_ptr_, current_index_));
+    } else {
+      writer.Write(
+          base::Vector<const base::uc16>(two_byte_ptr_, current_index_));
+    }
+    return Just(true);
+  }
+  DCHECK(result == EXCEPTION);
+  CHECK(isolate_->has_exception());
+  return Nothing<bool>();
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<Object> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -1253,6 +1491,13 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
     return SUCCESS;
   }
 
+  if (replacer_function_.is_null()) {
+    ObjectLayout* layout = layout_cache_.Lookup(*map);
+    if (layout != nullptr) {
+      return SerializeJSObjectWithLayout(object, key, map, layout);
+    }
+  }
+
   Result stack_push = StackPush(object, key);
   if (stack_push != SUCCESS) return stack_push;
   AppendCharacter('{');
@@ -1307,6 +1552,86 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
   return SUCCESS;
 }
 
+bool JsonStringifier::ObjectLayout::Build(
+    Tagged<Map> map, const DisallowGarbageCollection& no_gc) {
+  properties_.clear();
+  key_fragments_.clear();
+  ReadOnlyRoots roots = map->GetReadOnlyRoots();
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors();
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    // Skip the same properties as SerializeJSObject.
+    Tagged<Name> name = descriptors->GetKey(i);
+    if (!IsString(name)) continue;
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.IsDontEnum()) continue;
+    if (details.location() != PropertyLocation::kField) return false;
+    DCHECK_EQ(PropertyKind::kData, details.kind());
+    Tagged<String> key = Cast<String>(name);
+    if (key->map() != roots.internalized_one_byte_string_map()) return false;
+    base::Vector<const uint8_t> chars =
+        Cast<SeqOneByteString>(key)->GetCharVector<uint8_t>(no_gc);
+    if (!std::all_of(chars.begin(), chars.end(), DoNotEscape<uint8_t>)) {
+      return false;
+    }
+    uint32_t key_start = static_cast<uint32_t>(key_fragments_.size());
+    key_fragments_.push_back('"');
+    key_fragments_.insert(key_fragments_.end(), chars.begin(), chars.end());
+    key_fragments_.push_back('"');
+    key_fragments_.push_back(':');
+    uint32_t key_length =
+        static_cast<uint32_t>(key_fragments_.size()) - key_start;
+    properties_.push_back(
+        {i, FieldIndex::ForDetails(map, details), key_start, key_length});
+  }
+  return true;
+}
+
+JsonStringifier::Result JsonStringifier::SerializeJSObjectWithLayout(
+    Handle<JSObject> object, Handle<Object> key, DirectHandle<Map> map,
+    ObjectLayout* layout) {
+  PtrComprCageBase cage_base(isolate_);
+  DCHECK(replacer_function_.is_null());
+  DCHECK(pending_key_fragment_.empty());
+
+  Result stack_push = StackPush(object, key);
+  if (stack_push != SUCCESS) return stack_push;
+
+  ObjectLayout::UseScope use_scope(layout);
+  AppendCharacter('{');
+  Indent();
+  bool comma = false;
+  for (const ObjectLayout::Property& property : layout->properties()) {
+    Handle<String> key_name(
+        Cast<String>(
+            map->instance_descriptors(cage_base)->GetKey(property.descriptor)),
+        isolate_);
+    Handle<Object> value;
+    if (*map == object->map(cage_base)) {
+      // Read the raw property to avoid reboxing doubles in mutable boxes.
+      value = handle(object->RawFastPropertyAt(property.field_index), isolate_);
+    } else {
+      // A toJSON function changed the shape of the object.
+      if (!need_stack_) {
+        need_stack_ = true;
+        return NEED_STACK;
+      }
+      ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+          isolate_, value,
+          Object::GetPropertyOrElement(isolate_, object, key_name), EXCEPTION);
+    }
+    pending_key_fragment_ = layout->key_fragment(property);
+    Result result = SerializeProperty(value, comma, key_name);
+    pending_key_fragment_ = base::Vector<const uint8_t>();
+    if (!comma && result == SUCCESS) comma = true;
+    if (result == EXCEPTION || result == NEED_STACK) return result;
+  }
+  Unindent();
+  if (comma) NewLine();
+  AppendCharacter('}');
+  StackPop();
+  return SUCCESS;
+}
+
 JsonStringifier::Result JsonStringifier::SerializeJSReceiverSlow(
     Handle<JSReceiver> object) {
   Handle<FixedArray> contents = property_list_;
@@ -1585,9 +1910,30 @@ void JsonStringifier::Separator(bool first) {
   NewLine();
 }
 
+void JsonStringifier::AppendKeyFragment(
+    base::Vector<const uint8_t> fragment) {
+  int length = static_cast<int>(fragment.length());
+  while (!CurrentPartCanFit(length)) Extend();
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    CopyChars<uint8_t, uint8_t>(one_byte_ptr_ + current_index_,
+                                fragment.begin(), length);
+  } else {
+    CopyChars<uint8_t, base::uc16>(two_byte_ptr_ + current_index_,
+                                   fragment.begin(), length);
+  }
+  current_index_ += length;
+  DCHECK(HasValidCurrentIndex());
+}
+
 void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
                                            Handle<Object> deferred_key) {
   Separator(!deferred_comma);
+  if (!pending_key_fragment_.empty()) {
+    AppendKeyFragment(pending_key_fragment_);
+    pending_key_fragment_ = base::Vector<const uint8_t>();
+    if (gap_ != nullptr) AppendCharacter(' ');
+    return;
+  }
   Handle<String> string_key = Cast<String>(deferred_key);
   bool wrote_simple = false;
   {
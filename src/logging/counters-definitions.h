@@ -89,9 +89,15 @@ namespace internal {
      0, 1, 2)                                                                  \
   /* Ticks observed in a single Turbofan compilation, in 1K. */                \
   HR(turbofan_ticks, V8.TurboFan1KTicks, 0, 100000, 200)                       \
+  /* Jobs in the concurrent Turbofan input queue after queueing a job. */      \
+  HR(turbofan_optimize_queue_length, V8.TurboFanOptimizeQueueLength, 0, 100,   \
+     101)                                                                      \
   /* Backtracks observed in a single regexp interpreter execution. */          \
   /* The maximum of 100M backtracks takes roughly 2 seconds on my machine. */  \
   HR(regexp_backtracks, V8.RegExpBacktracks, 1, 100000000, 50)                 \
+  /* Work (characters and weighted backtracks) of a single regexp */          \
+  /* interpreter execution, which regexp tier-up is based on. */               \
+  HR(regexp_interpreter_work, V8.RegExpInterpreterWork, 1, 100000000, 50)      \
   /* Number of times a cache event is triggered for a wasm module. */          \
   HR(wasm_cache_count, V8.WasmCacheCount, 0, 100, 101)                         \
   /* Number of in-use external pointers in the external pointer table. */      \
@@ -244,6 +250,8 @@ namespace internal {
      V8.TurboFanOptimizeNonConcurrentTotalTime, 10000000, MICROSECOND)         \
   HT(turbofan_optimize_concurrent_total_time,                                  \
      V8.TurboFanOptimizeConcurrentTotalTime, 10000000, MICROSECOND)            \
+  HT(turbofan_optimize_queue_wait_time, V8.TurboFanOptimizeQueueWaitTime,      \
+     10000000, MICROSECOND)                                                    \
   HT(turbofan_osr_prepare, V8.TurboFanOptimizeForOnStackReplacementPrepare,    \
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_execute, V8.TurboFanOptimizeForOnStackReplacementExecute,    \
@@ -339,6 +347,8 @@ namespace internal {
   /* Number of times the cache contained a reusable Script but not */          \
   /* the root SharedFunctionInfo. */                                           \
   SC(compilation_cache_partial_hits, V8.CompilationCachePartialHits)           \
+  /* Concurrent Turbofan jobs whose results were thrown away. */               \
+  SC(turbofan_optimize_jobs_discarded, V8.TurboFanOptimizeJobsDiscarded)       \
   SC(objs_since_last_young, V8.ObjsSinceLastYoung)                             \
   SC(objs_since_last_full, V8.ObjsSinceLastFull)                               \
   SC(gc_compactor_caused_by_request, V8.GCCompactorCausedByRequest)            \
@@ -350,7 +360,13 @@ namespace internal {
   SC(maps_created, V8.MapsCreated)                                             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
+  SC(regexp_tier_up_by_cost, V8.RegExpTierUpByCost)                            \
+  SC(regexp_tier_up_by_subject_length, V8.RegExpTierUpBySubjectLength)         \
+  SC(regexp_tier_up_for_global_replace, V8.RegExpTierUpForGlobalReplace)       \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
+  SC(maglev_bounds_checks_eliminated, V8.MaglevBoundsChecksEliminated)         \
+  /* Read-only space pages mapped from the snapshot blob. */                   \
+  SC(read_only_snapshot_pages_mapped, V8.ReadOnlySnapshotPagesMapped)          \
   SC(new_space_bytes_available, V8.MemoryNewSpaceBytesAvailable)               \
   SC(new_space_bytes_committed, V8.MemoryNewSpaceBytesCommitted)               \
   SC(new_space_bytes_used, V8.MemoryNewSpaceBytesUsed)                         \
@@ -327,6 +327,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Compile, Script)                             \
   ADD_THREAD_SPECIFIC_COUNTER(V, Compile, CompileTask)                        \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AllocateFPRegisters)               \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AllocateGeneralAndFPRegisters)     \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AllocateSimd128Registers)          \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AllocateGeneralRegisters)          \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AssembleCode)                      \
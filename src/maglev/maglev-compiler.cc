@@ -124,6 +124,27 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
   }
 #endif
 
+  if (v8_flags.maglev_bounds_check_elimination) {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                 "V8.Maglev.BoundsCheckElimination");
+    GraphProcessor<BoundsCheckEliminationProcessor> processor(
+        compilation_info);
+    processor.ProcessGraph(graph);
+
+    if (v8_flags.print_maglev_graphs) {
+      UnparkedScopeIfOnBackground unparked_scope(local_isolate->heap());
+      std::cout << "After bounds check elimination" << std::endl;
+      PrintGraph(std::cout, compilation_info, graph);
+    }
+
+#ifdef DEBUG
+    {
+      GraphProcessor<MaglevGraphVerifier> verifier(compilation_info);
+      verifier.ProcessGraph(graph);
+    }
+#endif
+  }
+
   {
     // Post-hoc optimisation:
     //   - Dead node marking
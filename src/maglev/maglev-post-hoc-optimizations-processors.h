@@ -5,6 +5,13 @@
 #ifndef V8_MAGLEV_MAGLEV_POST_HOC_OPTIMIZATIONS_PROCESSORS_H_
 #define V8_MAGLEV_MAGLEV_POST_HOC_OPTIMIZATIONS_PROCESSORS_H_
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/base/container-utils.h"
+#include "src/compiler/js-heap-broker.h"
+#include "src/logging/counters.h"
 #include "src/maglev/maglev-compilation-info.h"
 #include "src/maglev/maglev-graph-printer.h"
 #include "src/maglev/maglev-graph-processor.h"
@@ -21,6 +28,194 @@ constexpr bool CanBeStoreToNonEscapedObject() {
          std::is_same_v<NodeT, StoreFloat64>;
 }
 
+// Removes bounds checks `index <u length` that are dominated by the true edge
+// of a branch on `index < length`, where {index} is known to be non-negative.
+// This covers the common array loop
+//
+//   for (let i = 0; i < a.length; i++) a[i];
+//
+// where {i} is an induction variable that starts at a non-negative value and
+// only grows, and the loop condition compares it against the same length
+// value that the element access checks.
+//
+// The conditions that hold at the start of each block are the intersection of
+// those at the end of its predecessors. Loop headers and exception handlers
+// start with no known conditions, so a condition never survives into the next
+// iteration of the loop it was checked in.
+class BoundsCheckEliminationProcessor {
+ public:
+  explicit BoundsCheckEliminationProcessor(
+      MaglevCompilationInfo* compilation_info)
+      : counters_(compilation_info->broker()->isolate()->counters()) {}
+
+  void PreProcessGraph(Graph* graph) {}
+  void PostProcessGraph(Graph* graph) {}
+
+  void PreProcessBasicBlock(BasicBlock* block) {
+    current_ = ConditionsAtEntry(block);
+  }
+
+  ProcessResult Process(CheckInt32Condition* node,
+                        const ProcessingState& state) {
+    if (node->condition() != AssertCondition::kUnsignedLessThan) {
+      return ProcessResult::kContinue;
+    }
+    ValueNode* index = UnwrapConversions(node->left_input().node());
+    ValueNode* length = UnwrapConversions(node->right_input().node());
+    if (!IsKnownLessThan(index, length) || !IsNonNegative(index, 0)) {
+      return ProcessResult::kContinue;
+    }
+    // The check has no uses itself, so drop its uses of the inputs to let
+    // dead code elimination remove inputs that are only needed here.
+    for (Input& input : *node) {
+      input.node()->remove_use();
+    }
+    // The uses of the values in its deopt frame are kept on purpose. The graph
+    // builder counts them once per checkpointed frame, not per node, and other
+    // nodes can still deopt to the same frame. Like other passes that remove
+    // checks, this may keep values alive longer than needed, but never drops
+    // a value that a deopt still needs.
+    counters_->maglev_bounds_checks_eliminated()->Increment();
+    return ProcessResult::kRemove;
+  }
+
+  template <typename NodeT>
+  ProcessResult Process(NodeT* node, const ProcessingState& state) {
+    if constexpr (std::is_base_of_v<ControlNode, NodeT>) {
+      conditions_at_exit_[state.block()] = current_;
+    }
+    return ProcessResult::kContinue;
+  }
+
+ private:
+  // A pair (a, b) means that a < b holds for the signed int32 values.
+  using Conditions = std::vector<std::pair<ValueNode*, ValueNode*>>;
+
+  static constexpr int kMaxDepth = 8;
+
+  // Skips nodes that change the representation of a value but not the value,
+  // so that untagged and tagged uses of the same value compare equal.
+  static ValueNode* UnwrapConversions(ValueNode* node) {
+    while (true) {
+      switch (node->opcode()) {
+        case Opcode::kIdentity:
+        case Opcode::kCheckedSmiSizedInt32:
+        case Opcode::kCheckedSmiTagInt32:
+        case Opcode::kUnsafeSmiTagInt32:
+        case Opcode::kCheckedSmiUntag:
+        case Opcode::kUnsafeSmiUntag:
+        case Opcode::kCheckedObjectToIndex:
+        case Opcode::kInt32ToNumber:
+          node = node->input(0).node();
+          break;
+        default:
+          return node;
+      }
+    }
+  }
+
+  // Whether {node} never produces a negative value. Phis are assumed to be
+  // non-negative while their inputs are visited, which proves induction
+  // variables that start non-negative and are only incremented. Additions
+  // deoptimize on overflow, so they cannot wrap around.
+  bool IsNonNegative(ValueNode* node, int depth) {
+    node = UnwrapConversions(node);
+    if (depth > kMaxDepth) return false;
+    switch (node->opcode()) {
+      case Opcode::kInt32Constant:
+        return node->Cast<Int32Constant>()->value() >= 0;
+      case Opcode::kSmiConstant:
+        return node->Cast<SmiConstant>()->value().value() >= 0;
+      case Opcode::kUint32Constant:
+        // The index is compared as an int32, so larger values are negative.
+        return node->Cast<Uint32Constant>()->value() <=
+               static_cast<uint32_t>(kMaxInt);
+      case Opcode::kInt32IncrementWithOverflow:
+      case Opcode::kCheckedSmiIncrement:
+        return IsNonNegative(node->input(0).node(), depth + 1);
+      case Opcode::kInt32AddWithOverflow:
+        return IsNonNegative(node->input(0).node(), depth + 1) &&
+               IsNonNegative(node->input(1).node(), depth + 1);
+      case Opcode::kPhi: {
+        if (base::contains(assumed_phis_, node)) return true;
+        assumed_phis_.push_back(node);
+        bool result = true;
+        for (Input& input : *node) {
+          if (!IsNonNegative(input.node(), depth + 1)) {
+            result = false;
+            break;
+          }
+        }
+        assumed_phis_.pop_back();
+        return result;
+      }
+      default:
+        return false;
+    }
+  }
+
+  bool IsKnownLessThan(ValueNode* left, ValueNode* right) const {
+    return base::contains(current_, std::make_pair(left, right));
+  }
+
+  // Adds the condition that holds when {branch} jumps to {target}.
+  static void AddBranchCondition(ControlNode* branch, BasicBlock* target,
+                                 Conditions& conditions) {
+    auto* compare = branch->TryCast<BranchIfInt32Compare>();
+    if (!compare || compare->if_true() == compare->if_false()) return;
+    ValueNode* left = UnwrapConversions(compare->left_input().node());
+    ValueNode* right = UnwrapConversions(compare->right_input().node());
+    bool if_true = compare->if_true() == target;
+    switch (compare->operation()) {
+      case Operation::kLessThan:
+        if (if_true) conditions.emplace_back(left, right);
+        break;
+      case Operation::kGreaterThan:
+        if (if_true) conditions.emplace_back(right, left);
+        break;
+      case Operation::kLessThanOrEqual:
+        if (!if_true) conditions.emplace_back(right, left);
+        break;
+      case Operation::kGreaterThanOrEqual:
+        if (!if_true) conditions.emplace_back(left, right);
+        break;
+      default:
+        break;
+    }
+  }
+
+  Conditions ConditionsAtEntry(BasicBlock* block) {
+    if (block->is_loop() || block->is_exception_handler_block()) return {};
+    Conditions result;
+    bool first = true;
+    bool unknown_predecessor = false;
+    block->ForEachPredecessor([&](BasicBlock* predecessor) {
+      auto it = conditions_at_exit_.find(predecessor);
+      if (it == conditions_at_exit_.end()) {
+        unknown_predecessor = true;
+        return;
+      }
+      Conditions incoming = it->second;
+      AddBranchCondition(predecessor->control_node(), block, incoming);
+      if (first) {
+        result = std::move(incoming);
+        first = false;
+        return;
+      }
+      base::erase_if(result, [&](const auto& condition) {
+        return !base::contains(incoming, condition);
+      });
+    });
+    if (unknown_predecessor) return {};
+    return result;
+  }
+
+  Counters* const counters_;
+  Conditions current_;
+  std::unordered_map<BasicBlock*, Conditions> conditions_at_exit_;
+  std::vector<ValueNode*> assumed_phis_;
+};
+
 class AnyUseMarkingProcessor {
  public:
   void PreProcessGraph(Graph* graph) {}
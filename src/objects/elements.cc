@@ -909,14 +909,16 @@ class ElementsAccessorBase : public InternalElementsAccessor {
         THROW_NEW_ERROR(isolate,
                         NewRangeError(MessageTemplate::kInvalidArrayLength));
       }
-      new_elements = isolate->factory()->NewFixedDoubleArray(capacity);
+      new_elements = isolate->factory()->NewFixedDoubleArray(
+          capacity, RuntimeAllocationSite::kArrayGrowth);
     } else {
       if (!isolate->context().is_null() &&
           !base::IsInRange(capacity, 0, FixedArray::kMaxLength)) {
         THROW_NEW_ERROR(isolate,
                         NewRangeError(MessageTemplate::kInvalidArrayLength));
       }
-      new_elements = isolate->factory()->NewFixedArray(capacity);
+      new_elements = isolate->factory()->NewFixedArrayWithHoles(
+          capacity, RuntimeAllocationSite::kArrayGrowth);
     }
 
     int packed_size = kPackedSizeNotKnown;
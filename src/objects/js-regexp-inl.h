@@ -97,6 +97,16 @@ void JSRegExp::set_capture_name_map(Handle<FixedArray> capture_name_map) {
   }
 }
 
+Tagged<Object> JSRegExp::experimental_dfa() const {
+  DCHECK_EQ(type_tag(), EXPERIMENTAL);
+  return DataAt(kExperimentalDfaIndex);
+}
+
+void JSRegExp::set_experimental_dfa(Tagged<Object> dfa) {
+  DCHECK_EQ(type_tag(), EXPERIMENTAL);
+  SetDataAt(kExperimentalDfaIndex, dfa);
+}
+
 Tagged<Object> JSRegExp::DataAt(int index) const {
   DCHECK(type_tag() != NOT_COMPILED);
   return Cast<FixedArray>(data())->get(index);
@@ -4,6 +4,8 @@
 
 #include "src/objects/js-regexp.h"
 
+#include <algorithm>
+
 #include "src/base/strings.h"
 #include "src/common/globals.h"
 #include "src/objects/code.h"
@@ -222,23 +224,18 @@ bool JSRegExp::MarkedForTierUp() {
   return Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) == 0;
 }
 
-void JSRegExp::ResetLastTierUpTick() {
-  DCHECK(v8_flags.regexp_tier_up);
-  DCHECK_EQ(type_tag(), JSRegExp::IRREGEXP);
-  int tier_up_ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) + 1;
-  Cast<FixedArray>(data())->set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
-                                Smi::FromInt(tier_up_ticks));
-}
-
-void JSRegExp::TierUpTick() {
+bool JSRegExp::TierUpTick(int ticks) {
   DCHECK(v8_flags.regexp_tier_up);
   DCHECK_EQ(type_tag(), JSRegExp::IRREGEXP);
+  DCHECK_GT(ticks, 0);
   int tier_up_ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex));
   if (tier_up_ticks == 0) {
-    return;
+    return false;
   }
+  tier_up_ticks = std::max(tier_up_ticks - ticks, 0);
   Cast<FixedArray>(data())->set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
-                                Smi::FromInt(tier_up_ticks - 1));
+                                Smi::FromInt(tier_up_ticks));
+  return tier_up_ticks == 0;
 }
 
 void JSRegExp::MarkTierUpForNextExec() {
@@ -81,6 +81,11 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   inline int capture_count() const;
   inline Tagged<Object> capture_name_map();
   inline void set_capture_name_map(Handle<FixedArray> capture_name_map);
+  // This could be a Smi kUninitializedValue, a
+  // Managed<ExperimentalRegExpDfa>, or undefined if the DFA was dropped for
+  // serialization and has yet to be rebuilt.
+  inline Tagged<Object> experimental_dfa() const;
+  inline void set_experimental_dfa(Tagged<Object> dfa);
   uint32_t backtrack_limit() const;
 
   static constexpr Flag AsJSRegExpFlag(RegExpFlag f) {
@@ -123,8 +128,9 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
 
   bool CanTierUp();
   bool MarkedForTierUp();
-  void ResetLastTierUpTick();
-  void TierUpTick();
+  // Charges an interpreted execution that was as expensive as `ticks` cheap
+  // ones. Returns true if this marked the regexp for tier-up.
+  bool TierUpTick(int ticks);
   void MarkTierUpForNextExec();
 
   bool ShouldProduceBytecode();
@@ -198,9 +204,10 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // (1-based) capture group indices (at indices 2i + 1).
   static constexpr int kIrregexpCaptureNameMapIndex =
       kIrregexpCaptureCountIndex + 1;
-  // Tier-up ticks are set to the value of the tier-up ticks flag. The value is
-  // decremented on each execution of the bytecode, so that the tier-up
-  // happens once the ticks reach zero.
+  // Tier-up ticks are set to the value of the tier-up ticks flag. Each
+  // execution of the bytecode decrements the value by its estimated cost in
+  // ticks (see IrregexpInterpreter), so that the tier-up happens once the
+  // ticks reach zero.
   // This value is ignored if the regexp-tier-up flag isn't turned on.
   static constexpr int kIrregexpTicksUntilTierUpIndex =
       kIrregexpCaptureNameMapIndex + 1;
@@ -218,7 +225,12 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // various fields from the data array. `RegExpExecInternal` should probably
   // distinguish between EXPERIMENTAL and IRREGEXP, and then we can get rid of
   // all the IRREGEXP only fields.
-  static constexpr int kExperimentalDataSize = kIrregexpDataSize;
+  // The lazily built DFA of the bytecode, which is kept across executions so
+  // that its states don't have to be computed again. A Smi marker value equal
+  // to kUninitializedValue if the regexp isn't compiled yet or the bytecode
+  // can't be run by a DFA.
+  static constexpr int kExperimentalDfaIndex = kIrregexpDataSize;
+  static constexpr int kExperimentalDataSize = kExperimentalDfaIndex + 1;
 
   // In-object fields.
   static constexpr int kLastIndexFieldIndex = 0;
@@ -246,6 +258,9 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // The heuristic value for the length of the subject string for which we
   // tier-up to the compiler immediately, instead of using the interpreter.
   static constexpr int kTierUpForSubjectLengthValue = 1000;
+  // The work charged for each backtrack of an interpreted execution, relative
+  // to looking at one subject character.
+  static constexpr int kTierUpBacktrackWork = 4;
 
   // Maximum number of captures allowed.
   static constexpr int kMaxCaptures = 1 << 16;
@@ -59,8 +59,10 @@ Handle<String> String::SlowFlatten(Isolate* isolate, Handle<ConsString> cons,
   Handle<SeqString> result;
   if (cons->IsOneByteRepresentation()) {
     Handle<SeqOneByteString> flat =
-        isolate->factory()
-            ->NewRawOneByteString(length, allocation)
+        (allocation == AllocationType::kYoung
+             ? isolate->factory()->NewRawOneByteString(
+                   length, RuntimeAllocationSite::kStringConcatenation)
+             : isolate->factory()->NewRawOneByteString(length, allocation))
             .ToHandleChecked();
     // When the ConsString had a forwarding index, it is possible that it was
     // transitioned to a ThinString (and eventually shortcutted to
@@ -75,8 +77,10 @@ Handle<String> String::SlowFlatten(Isolate* isolate, Handle<ConsString> cons,
     result = flat;
   } else {
     Handle<SeqTwoByteString> flat =
-        isolate->factory()
-            ->NewRawTwoByteString(length, allocation)
+        (allocation == AllocationType::kYoung
+             ? isolate->factory()->NewRawTwoByteString(
+                   length, RuntimeAllocationSite::kStringConcatenation)
+             : isolate->factory()->NewRawTwoByteString(length, allocation))
             .ToHandleChecked();
     // When the ConsString had a forwarding index, it is possible that it was
     // transitioned to a ThinString (and eventually shortcutted to
@@ -1319,6 +1323,119 @@ int SearchString(Isolate* isolate, String::FlatContent receiver_content,
                       start_index);
 }
 
+// Ropes shorter than this are flattened before searching them. Flattening
+// is cheap for them, and it speeds up later operations on the same string.
+constexpr int kMinConsStringLengthToSearchInPlace = 1024;
+
+// Searches the segments of a ConsString one after the other, without
+// flattening it, and collects up to {max_matches} non-overlapping matches. A
+// match that straddles segment boundaries starts within the last
+// {pattern.length() - 1} characters preceding a segment, which are kept in
+// {carry_}.
+template <typename PatternChar>
+class ConsStringSearchVisitor {
+ public:
+  ConsStringSearchVisitor(Isolate* isolate,
+                          base::Vector<const PatternChar> pattern,
+                          int start_index, int32_t* matches, int max_matches)
+      : isolate_(isolate),
+        pattern_(pattern),
+        position_(start_index),
+        next_start_(start_index),
+        matches_(matches),
+        max_matches_(max_matches) {}
+
+  void VisitOneByteString(const uint8_t* chars, int length) {
+    Visit(chars, length);
+  }
+
+  void VisitTwoByteString(const base::uc16* chars, int length) {
+    Visit(chars, length);
+  }
+
+  bool done() const { return match_count_ == max_matches_; }
+  int match_count() const { return match_count_; }
+
+ private:
+  template <typename Char>
+  void Visit(const Char* chars, int length) {
+    DCHECK(!done());
+    const int carry_length = static_cast<int>(carry_.size());
+    const int overlap = pattern_.length() - 1;
+    if (carry_length > 0) {
+      // Look for matches starting in the carry, completed by the start of
+      // this segment. Matches starting in this segment are left to the
+      // search below.
+      int take = std::min(length, overlap);
+      window_.resize_no_init(carry_length + take);
+      std::copy(carry_.begin(), carry_.end(), window_.begin());
+      std::copy(chars, chars + take, window_.begin() + carry_length);
+      Search(window_.data(), carry_length + take, position_ - carry_length);
+      if (done()) return;
+    }
+    Search(chars, length, position_);
+    if (done()) return;
+    // Keep the last {overlap} characters seen for the next boundary.
+    if (length >= overlap) {
+      carry_.resize_no_init(overlap);
+      std::copy(chars + length - overlap, chars + length, carry_.begin());
+    } else {
+      int keep = std::min(carry_length, overlap - length);
+      std::copy(carry_.end() - keep, carry_.end(), carry_.begin());
+      carry_.resize_no_init(keep + length);
+      std::copy(chars, chars + length, carry_.begin() + keep);
+    }
+    position_ += length;
+  }
+
+  // Records the matches in {chars}, which start at {offset} in the cons
+  // string, that don't overlap the ones found before.
+  template <typename Char>
+  void Search(const Char* chars, int length, int offset) {
+    base::Vector<const Char> subject(chars, length);
+    while (!done()) {
+      int index = std::max(next_start_ - offset, 0);
+      if (index + pattern_.length() > length) return;
+      index = SearchString(isolate_, subject, pattern_, index);
+      if (index == -1) return;
+      matches_[match_count_++] = offset + index;
+      next_start_ = offset + index + pattern_.length();
+    }
+  }
+
+  Isolate* const isolate_;
+  const base::Vector<const PatternChar> pattern_;
+  // Index in the cons string of the next segment's first character.
+  int position_;
+  // Index in the cons string at which the next match may start.
+  int next_start_;
+  int32_t* const matches_;
+  const int max_matches_;
+  int match_count_ = 0;
+  base::SmallVector<base::uc16, 32> carry_;
+  base::SmallVector<base::uc16, 64> window_;
+};
+
+template <typename PatternChar>
+int SearchConsString(Isolate* isolate, Tagged<ConsString> cons,
+                     base::Vector<const PatternChar> pattern, int start_index,
+                     int32_t* matches, int max_matches,
+                     const DisallowGarbageCollection& no_gc) {
+  ConsStringSearchVisitor<PatternChar> visitor(isolate, pattern, start_index,
+                                               matches, max_matches);
+  ConsStringIterator iter(cons, start_index);
+  int offset;
+  for (Tagged<String> segment = iter.Next(&offset); !segment.is_null();
+       segment = iter.Next(&offset)) {
+    // Segments are never cons strings themselves.
+    Tagged<ConsString> nested = String::VisitFlat(&visitor, segment, offset);
+    DCHECK(nested.is_null());
+    USE(nested);
+    if (visitor.done()) break;
+  }
+  return visitor.match_count();
+}
+
 }  // namespace
 
 int String::IndexOf(Isolate* isolate, Handle<String> receiver,
@@ -1332,6 +1449,14 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
   uint32_t receiver_length = receiver->length();
   if (start_index + search_length > receiver_length) return -1;
 
+  if (CanSearchInPlace(*receiver)) {
+    int32_t match;
+    if (SearchInPlace(isolate, receiver, search, start_index, &match, 1) == 0) {
+      return -1;
+    }
+    return match;
+  }
+
   receiver = String::Flatten(isolate, receiver);
   search = String::Flatten(isolate, search);
 
@@ -1351,6 +1476,42 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
                                         start_index);
 }
 
+bool String::CanSearchInPlace(Tagged<String> receiver) {
+  if (!IsConsString(receiver) || receiver->IsFlat() ||
+      receiver->length() < kMinConsStringLengthToSearchInPlace) {
+    return false;
+  }
+  // ConsStringIterator keeps a frame for every cons string whose left side
+  // it is walking. Once the left spine is deeper than its stack, it has to
+  // restart from the root for every segment, which makes the walk quadratic.
+  // Such ropes, typically built by appending in a loop, are flattened.
+  Tagged<String> left = Cast<ConsString>(receiver)->first();
+  for (int depth = 1; IsConsString(left); depth++) {
+    if (depth >= ConsStringIterator::kStackSize) return false;
+    left = Cast<ConsString>(left)->first();
+  }
+  return true;
+}
+
+int String::SearchInPlace(Isolate* isolate, Handle<String> receiver,
+                          Handle<String> search, int start_index,
+                          int32_t* matches, int max_matches) {
+  DCHECK(CanSearchInPlace(*receiver));
+  DCHECK_LT(0, search->length());
+  DCHECK_LT(0, max_matches);
+  search = String::Flatten(isolate, search);
+
+  DisallowGarbageCollection no_gc;
+  Tagged<ConsString> cons = Cast<ConsString>(*receiver);
+  String::FlatContent search_content = search->GetFlatContent(no_gc);
+  if (search_content.IsOneByte()) {
+    return SearchConsString(isolate, cons, search_content.ToOneByteVector(),
+                            start_index, matches, max_matches, no_gc);
+  }
+  return SearchConsString(isolate, cons, search_content.ToUC16Vector(),
+                          start_index, matches, max_matches, no_gc);
+}
+
 MaybeHandle<String> String::GetSubstitution(Isolate* isolate, Match* match,
                                             Handle<String> replacement,
                                             int start_index) {
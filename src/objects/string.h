@@ -331,10 +331,22 @@ V8_OBJECT class String : public Name {
                                 Handle<Object> search, Handle<Object> position);
   // Perform string match of pattern on subject, starting at start index.
   // Caller must ensure that 0 <= start_index <= sub->length(), as this does not
-  // check any arguments.
+  // check any arguments. ConsStrings for which CanSearchInPlace holds are
+  // searched segment by segment rather than flattened.
   static int IndexOf(Isolate* isolate, Handle<String> receiver,
                      Handle<String> search, int start_index);
 
+  // Whether |receiver| is a long rope that can be searched without flattening
+  // it, i.e. one that is not too left-deep to walk in linear time.
+  static bool CanSearchInPlace(Tagged<String> receiver);
+  // Collects up to |max_matches| non-overlapping occurrences of the non-empty
+  // |search| at or after |start_index| in one pass over the segments of
+  // |receiver|, for which CanSearchInPlace must hold. Stores their start
+  // indices in |matches| and returns their number.
+  static int SearchInPlace(Isolate* isolate, Handle<String> receiver,
+                           Handle<String> search, int start_index,
+                           int32_t* matches, int max_matches);
+
   static Tagged<Object> LastIndexOf(Isolate* isolate, Handle<Object> receiver,
                                     Handle<Object> search,
                                     Handle<Object> position);
@@ -1224,6 +1236,10 @@ class V8_EXPORT_PRIVATE FlatStringReader : public Relocatable {
 // traversal of the entire string
 class ConsStringIterator {
  public:
+  // Number of cons strings with pending right sides that can be tracked
+  // without restarting the traversal from the root.
+  static const int kStackSize = 32;
+
   inline ConsStringIterator() = default;
   inline explicit ConsStringIterator(Tagged<ConsString> cons_string,
                                      int offset = 0) {
@@ -1249,7 +1265,6 @@ class ConsStringIterator {
   }
 
  private:
-  static const int kStackSize = 32;
   // Use a mask instead of doing modulo operations for stack wrapping.
   static const int kDepthMask = kStackSize - 1;
   static_assert(base::bits::IsPowerOfTwo(kStackSize),
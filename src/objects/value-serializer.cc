@@ -6,6 +6,7 @@
 
 #include <type_traits>
 
+#include "include/v8-array-buffer.h"
 #include "include/v8-maybe.h"
 #include "include/v8-value-serializer-version.h"
 #include "include/v8-value-serializer.h"
@@ -21,6 +22,7 @@
 #include "src/handles/shared-object-conveyor-handles.h"
 #include "src/heap/factory.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-array-buffer.h"
@@ -186,6 +188,10 @@ enum class SerializationTag : uint8_t {
   kResizableArrayBuffer = '~',
   // Array buffer (transferred). transferID:uint32_t
   kArrayBufferTransfer = 't',
+  // Array buffer with contents stored out of band. blobID:raw uint32_t,
+  // byteLength:uint32_t. The blob ID is written with a fixed width, so that
+  // the IDs of moved buffers can be filled in once the whole value is written.
+  kArrayBufferBlob = 'O',
   // View into an array buffer.
   // subtag:ArrayBufferViewTag, byteOffset:uint32_t, byteLength:uint32_t
   // For typed arrays, byteOffset and byteLength must be divisible by the size
@@ -293,7 +299,8 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
       array_buffer_transfer_map_(isolate->heap(),
-                                 ZoneAllocationPolicy(&zone_)) {
+                                 ZoneAllocationPolicy(&zone_)),
+      moved_array_buffers_(isolate->heap()) {
   if (delegate_) {
     v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
     has_custom_host_objects_ = delegate_->HasCustomHostObject(v8_isolate);
@@ -319,6 +326,67 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetArrayBufferBlobThreshold(
+    size_t min_byte_length, v8::ValueSerializer::ArrayBufferBlobMode mode) {
+  DCHECK_NOT_NULL(delegate_);
+  array_buffer_blob_threshold_ = min_byte_length;
+  array_buffer_blob_mode_ = mode;
+}
+
+Maybe<bool> ValueSerializer::FinishMovedArrayBuffers(bool success) {
+  DCHECK_EQ(moved_array_buffers_.size(), moved_array_buffer_id_offsets_.size());
+  Maybe<bool> result = success ? Just(true) : Nothing<bool>();
+  // The backing stores are handed out only once the whole value is written,
+  // so that a failed write leaves no backing store shared with the delegate.
+  // Getters run while writing may have detached a buffer in the meantime,
+  // e.g. through ArrayBuffer.prototype.transfer, so check all of them before
+  // handing out any.
+  if (result.IsJust()) {
+    for (size_t i = 0; i < moved_array_buffers_.size(); ++i) {
+      if (moved_array_buffers_[i]->was_detached()) {
+        result = ThrowDataCloneError(
+            MessageTemplate::kDataCloneErrorDetachedArrayBuffer);
+        break;
+      }
+    }
+  }
+  size_t handed_out = 0;
+  if (result.IsJust()) {
+    v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+    for (; handed_out < moved_array_buffers_.size(); ++handed_out) {
+      Handle<JSArrayBuffer> array_buffer = moved_array_buffers_[handed_out];
+      std::shared_ptr<BackingStoreBase> backing_store =
+          array_buffer->GetBackingStore();
+      Maybe<uint32_t> blob_id = delegate_->GetArrayBufferBlobId(
+          v8_isolate, std::static_pointer_cast<v8::BackingStore>(
+                          std::move(backing_store)));
+      if (isolate_->has_exception()) {
+        result = Nothing<bool>();
+        break;
+      }
+      if (blob_id.IsNothing()) {
+        result = ThrowDataCloneError(MessageTemplate::kDataCloneError,
+                                     array_buffer);
+        break;
+      }
+      uint32_t raw_blob_id = blob_id.FromJust();
+      memcpy(buffer_ + moved_array_buffer_id_offsets_[handed_out],
+             &raw_blob_id, sizeof(raw_blob_id));
+    }
+  }
+  // A handed out backing store cannot be taken back from the delegate, so
+  // the buffers handed out before a failure are detached as well, and no
+  // backing store stays shared between the delegate and a live buffer. The
+  // detach keys were checked when the buffers were written and cannot be
+  // changed from JavaScript, so detaching cannot throw here.
+  for (size_t i = 0; i < handed_out; ++i) {
+    CHECK(JSArrayBuffer::Detach(moved_array_buffers_[i]).FromJust());
+  }
+  while (!moved_array_buffers_.empty()) moved_array_buffers_.Pop();
+  moved_array_buffer_id_offsets_.clear();
+  return result;
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -981,6 +1049,10 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
   if (byte_length > std::numeric_limits<uint32_t>::max()) {
     return ThrowDataCloneError(MessageTemplate::kDataCloneError, array_buffer);
   }
+  if (byte_length >= array_buffer_blob_threshold_ &&
+      !array_buffer->is_resizable_by_js()) {
+    return WriteJSArrayBufferBlob(array_buffer);
+  }
   if (array_buffer->is_resizable_by_js()) {
     size_t max_byte_length = array_buffer->max_byte_length();
     if (max_byte_length > std::numeric_limits<uint32_t>::max()) {
@@ -1000,6 +1072,58 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
   return ThrowIfOutOfMemory();
 }
 
+Maybe<bool> ValueSerializer::WriteJSArrayBufferBlob(
+    Handle<JSArrayBuffer> array_buffer) {
+  DCHECK_NOT_NULL(delegate_);
+  DCHECK(!array_buffer->is_shared());
+  DCHECK(!array_buffer->is_resizable_by_js());
+  size_t byte_length = array_buffer->byte_length();
+  if (array_buffer_blob_mode_ ==
+          v8::ValueSerializer::ArrayBufferBlobMode::kMove &&
+      array_buffer->is_detachable() &&
+      IsUndefined(array_buffer->detach_key(), isolate_) &&
+      array_buffer->GetBackingStore()) {
+    // The backing store is handed out by FinishMovedArrayBuffers, which also
+    // fills in the blob ID. The buffer is kept in a strong root until then,
+    // since the handle passed in may belong to a scope of an enclosing object.
+    WriteTag(SerializationTag::kArrayBufferBlob);
+    uint32_t placeholder_blob_id = 0;
+    size_t blob_id_offset = buffer_size_;
+    WriteRawBytes(&placeholder_blob_id, sizeof(placeholder_blob_id));
+    WriteVarint<uint32_t>(static_cast<uint32_t>(byte_length));
+    if (out_of_memory_) return ThrowIfOutOfMemory();
+    moved_array_buffers_.Push(*array_buffer);
+    moved_array_buffer_id_offsets_.push_back(blob_id_offset);
+    return Just(true);
+  }
+
+  std::unique_ptr<BackingStore> copy =
+      BackingStore::Allocate(isolate_, byte_length, SharedFlag::kNotShared,
+                             InitializedFlag::kUninitialized);
+  if (!copy) {
+    return ThrowDataCloneError(MessageTemplate::kDataCloneError, array_buffer);
+  }
+  if (byte_length > 0) {
+    memcpy(copy->buffer_start(), array_buffer->backing_store(), byte_length);
+  }
+  std::shared_ptr<BackingStoreBase> backing_store_base = std::move(copy);
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+  Maybe<uint32_t> blob_id = delegate_->GetArrayBufferBlobId(
+      v8_isolate,
+      std::static_pointer_cast<v8::BackingStore>(backing_store_base));
+  RETURN_VALUE_IF_EXCEPTION(isolate_, Nothing<bool>());
+  if (blob_id.IsNothing()) {
+    return ThrowDataCloneError(MessageTemplate::kDataCloneError,
+                               array_buffer);
+  }
+
+  WriteTag(SerializationTag::kArrayBufferBlob);
+  uint32_t raw_blob_id = blob_id.FromJust();
+  WriteRawBytes(&raw_blob_id, sizeof(raw_blob_id));
+  WriteVarint<uint32_t>(static_cast<uint32_t>(byte_length));
+  return ThrowIfOutOfMemory();
+}
+
 Maybe<bool> ValueSerializer::WriteJSArrayBufferView(
     Tagged<JSArrayBufferView> view) {
   if (treat_array_buffer_views_as_host_objects_) {
@@ -1641,6 +1765,9 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kArrayBufferTransfer: {
       return ReadTransferredJSArrayBuffer();
     }
+    case SerializationTag::kArrayBufferBlob: {
+      return ReadJSArrayBufferBlob();
+    }
     case SerializationTag::kSharedArrayBuffer: {
       constexpr bool is_shared = true;
       constexpr bool is_resizable = false;
@@ -2092,6 +2219,35 @@ MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadTransferredJSArrayBuffer() {
   return array_buffer;
 }
 
+MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadJSArrayBufferBlob() {
+  uint32_t id = next_id_++;
+  const void* raw_blob_id;
+  uint32_t blob_id;
+  uint32_t byte_length;
+  if (!ReadRawBytes(sizeof(blob_id), &raw_blob_id) ||
+      !ReadVarint<uint32_t>().To(&byte_length) || delegate_ == nullptr) {
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  memcpy(&blob_id, raw_blob_id, sizeof(blob_id));
+  std::shared_ptr<v8::BackingStore> blob = delegate_->GetArrayBufferBlobFromId(
+      reinterpret_cast<v8::Isolate*>(isolate_), blob_id);
+  if (!blob) {
+    RETURN_EXCEPTION_IF_EXCEPTION(isolate_);
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  std::shared_ptr<BackingStoreBase> blob_base = std::move(blob);
+  std::shared_ptr<BackingStore> backing_store =
+      std::static_pointer_cast<BackingStore>(std::move(blob_base));
+  if (backing_store->is_shared() || backing_store->is_resizable_by_js() ||
+      backing_store->byte_length() != byte_length) {
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  Handle<JSArrayBuffer> array_buffer =
+      isolate_->factory()->NewJSArrayBuffer(std::move(backing_store));
+  AddObjectWithID(id, array_buffer);
+  return array_buffer;
+}
+
 MaybeHandle<JSArrayBufferView> ValueDeserializer::ReadJSArrayBufferView(
     DirectHandle<JSArrayBuffer> buffer) {
   uint32_t buffer_byte_length = static_cast<uint32_t>(buffer->GetByteLength());
@@ -2417,6 +2573,30 @@ static void CommitProperties(Handle<JSObject> object, Handle<Map> map,
   }
 }
 
+MaybeHandle<Object> ValueDeserializer::ReadPropertyKey() {
+  SerializationTag tag;
+  if (!PeekTag().To(&tag)) return {};
+  if (tag != SerializationTag::kOneByteString &&
+      tag != SerializationTag::kUtf8String) {
+    return ReadObject();
+  }
+  // Look up one-byte and UTF-8 keys in the string table directly, rather than
+  // allocating a string that is thrown away once it has been internalized.
+  ConsumeTag(tag);
+  uint32_t byte_length;
+  base::Vector<const uint8_t> bytes;
+  if (!ReadVarint<uint32_t>().To(&byte_length) ||
+      byte_length > static_cast<uint32_t>(String::kMaxLength) ||
+      !ReadRawBytes(byte_length).To(&bytes)) {
+    return {};
+  }
+  if (tag == SerializationTag::kOneByteString) {
+    return isolate_->factory()->InternalizeString(bytes);
+  }
+  return isolate_->factory()->InternalizeUtf8String(
+      base::Vector<const char>::cast(bytes));
+}
+
 static bool IsValidObjectKey(Tagged<Object> value, Isolate* isolate) {
   if (IsSmi(value)) return true;
   auto instance_type = Cast<HeapObject>(value)->map(isolate)->instance_type();
@@ -2465,21 +2645,25 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
       // transition was found.
       Handle<Object> key;
       Handle<Map> target;
-      std::pair<Handle<String>, Handle<Map>> expected_transition;
-      {
-        TransitionsAccessor transitions(isolate_, *map);
+      if (byte_length <= static_cast<uint32_t>(String::kMaxLength) &&
+          byte_length <= static_cast<size_t>(end_ - position_) &&
+          (tag == SerializationTag::kOneByteString ||
+           (tag == SerializationTag::kUtf8String &&
+            String::IsAscii(position_, static_cast<int>(byte_length))))) {
+        // The raw bytes of one-byte and ASCII-only UTF-8 strings can be
+        // compared to the transition keys without creating a string.
         base::Vector<const uint8_t> key_chars(position_, byte_length);
-        auto expected_transition = transitions.ExpectedTransition(key_chars);
-        if (!expected_transition.first.is_null()) {
-          target = expected_transition.second;
-        }
-      }
-      if (!expected_transition.first.is_null()) {
+        std::pair<Handle<String>, Handle<Map>> expected_transition =
+            TransitionsAccessor(isolate_, *map).ExpectedTransition(key_chars);
         key = expected_transition.first;
+        target = expected_transition.second;
+      }
+      if (!key.is_null()) {
         position_ += byte_length;
       } else {
         position_ = start_position;
-        if (!ReadObject().ToHandle(&key) || !IsValidObjectKey(*key, isolate_)) {
+        if (!ReadPropertyKey().ToHandle(&key) ||
+            !IsValidObjectKey(*key, isolate_)) {
           return Nothing<uint32_t>();
         }
         if (IsString(*key, isolate_)) {
@@ -2569,7 +2753,8 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
     }
 
     Handle<Object> key;
-    if (!ReadObject().ToHandle(&key) || !IsValidObjectKey(*key, isolate_)) {
+    if (!ReadPropertyKey().ToHandle(&key) ||
+        !IsValidObjectKey(*key, isolate_)) {
       return Nothing<uint32_t>();
     }
     Handle<Object> value;
@@ -6,6 +6,8 @@
 #define V8_OBJECTS_VALUE_SERIALIZER_H_
 
 #include <cstdint>
+#include <limits>
+#include <vector>
 
 #include "include/v8-value-serializer.h"
 #include "src/base/compiler-specific.h"
@@ -13,6 +15,7 @@
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/common/message-template.h"
+#include "src/handles/global-handles.h"
 #include "src/handles/maybe-handles.h"
 #include "src/utils/identity-map.h"
 #include "src/zone/zone.h"
@@ -97,6 +100,23 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Writes the contents of ArrayBuffers of at least |min_byte_length| bytes
+   * out of band, via the delegate's GetArrayBufferBlobId. This should not be
+   * called when no Delegate was passed.
+   */
+  void SetArrayBufferBlobThreshold(
+      size_t min_byte_length, v8::ValueSerializer::ArrayBufferBlobMode mode);
+
+  /*
+   * Hands the backing stores of the ArrayBuffers that the preceding
+   * WriteObject call moved out of band to the delegate, and detaches the
+   * buffers. This is done only once the whole value has been written, since
+   * views written later may still refer to the buffers. If |success| is
+   * false, the buffers are left untouched and nothing is handed out.
+   */
+  Maybe<bool> FinishMovedArrayBuffers(bool success) V8_WARN_UNUSED_RESULT;
+
  private:
   // Managing allocations of the internal buffer.
   Maybe<bool> ExpandBuffer(size_t required_capacity);
@@ -131,6 +151,8 @@ class ValueSerializer {
   Maybe<bool> WriteJSSet(DirectHandle<JSSet> map) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSArrayBuffer(Handle<JSArrayBuffer> array_buffer)
       V8_WARN_UNUSED_RESULT;
+  Maybe<bool> WriteJSArrayBufferBlob(Handle<JSArrayBuffer> array_buffer)
+      V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSArrayBufferView(Tagged<JSArrayBufferView> array_buffer);
   Maybe<bool> WriteJSError(Handle<JSObject> error) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSSharedArray(DirectHandle<JSSharedArray> shared_array)
@@ -178,6 +200,9 @@ class ValueSerializer {
   bool has_custom_host_objects_ = false;
   bool treat_array_buffer_views_as_host_objects_ = false;
   bool out_of_memory_ = false;
+  size_t array_buffer_blob_threshold_ = std::numeric_limits<size_t>::max();
+  v8::ValueSerializer::ArrayBufferBlobMode array_buffer_blob_mode_ =
+      v8::ValueSerializer::ArrayBufferBlobMode::kCopy;
   Zone zone_;
 
   // To avoid extra lookups in the identity map, ID+1 is actually stored in the
@@ -189,6 +214,12 @@ class ValueSerializer {
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
 
+  // Array buffers whose backing stores are moved out of band, to be handed out
+  // and detached by FinishMovedArrayBuffers, along with the offsets of their
+  // blob IDs in the buffer.
+  GlobalHandleVector<JSArrayBuffer> moved_array_buffers_;
+  std::vector<size_t> moved_array_buffer_id_offsets_;
+
   // The conveyor used to keep shared objects alive.
   SharedObjectConveyorHandles* shared_object_conveyor_ = nullptr;
 };
@@ -275,6 +306,10 @@ class ValueDeserializer {
   // permissible for a string (with the relevant tag).
   MaybeHandle<String> ReadString() V8_WARN_UNUSED_RESULT;
 
+  // Reads a property key. One-byte and UTF-8 string keys are returned
+  // internalized.
+  MaybeHandle<Object> ReadPropertyKey() V8_WARN_UNUSED_RESULT;
+
   // Reading V8 objects of specific kinds.
   // The tag is assumed to have already been read.
   MaybeHandle<BigInt> ReadBigInt() V8_WARN_UNUSED_RESULT;
@@ -297,6 +332,7 @@ class ValueDeserializer {
       bool is_shared, bool is_resizable) V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBuffer> ReadTransferredJSArrayBuffer()
       V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSArrayBuffer> ReadJSArrayBufferBlob() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBufferView> ReadJSArrayBufferView(
       DirectHandle<JSArrayBuffer> buffer) V8_WARN_UNUSED_RESULT;
   bool ValidateJSArrayBufferViewFlags(
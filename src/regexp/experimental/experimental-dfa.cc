@@ -0,0 +1,246 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-dfa.h"
+
+#include <algorithm>
+
+namespace v8 {
+namespace internal {
+
+// static
+bool ExperimentalRegExpDfa::CanBeHandled(
+    base::Vector<const RegExpInstruction> bytecode) {
+  for (const RegExpInstruction& inst : bytecode) {
+    switch (inst.opcode) {
+      case RegExpInstruction::ASSERTION:
+      case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+      case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+        return false;
+      default:
+        break;
+    }
+  }
+  return true;
+}
+
+ExperimentalRegExpDfa::ExperimentalRegExpDfa(
+    base::Vector<const RegExpInstruction> bytecode)
+    : zone_(&allocator_, ZONE_NAME),
+      bytecode_(bytecode.begin(), bytecode.end(), &zone_),
+      class_bounds_(&zone_),
+      states_(&zone_),
+      seeds_(&zone_),
+      stack_(&zone_),
+      key_(&zone_),
+      visited_(2 * bytecode.length(), 0, &zone_) {
+  DCHECK(CanBeHandled(bytecode));
+
+  // Every range [min, max] splits the alphabet at min and max + 1.
+  class_bounds_.push_back(0);
+  for (const RegExpInstruction& inst : bytecode_) {
+    if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+    class_bounds_.push_back(inst.payload.consume_range.min);
+    if (inst.payload.consume_range.max != kMaxUInt16) {
+      class_bounds_.push_back(inst.payload.consume_range.max + 1);
+    }
+  }
+  std::sort(class_bounds_.begin(), class_bounds_.end());
+  class_bounds_.erase(std::unique(class_bounds_.begin(), class_bounds_.end()),
+                      class_bounds_.end());
+
+  int character_class = 0;
+  for (int c = 0; c < 256; ++c) {
+    if (character_class + 1 < static_cast<int>(class_bounds_.size()) &&
+        class_bounds_[character_class + 1] == c) {
+      ++character_class;
+    }
+    one_byte_classes_[c] = static_cast<base::uc16>(character_class);
+  }
+}
+
+int ExperimentalRegExpDfa::CharacterClass(base::uc16 c) const {
+  if (c < 256) return one_byte_classes_[c];
+  return static_cast<int>(
+      std::upper_bound(class_bounds_.begin(), class_bounds_.end(), c) -
+      class_bounds_.begin() - 1);
+}
+
+ExperimentalRegExpDfa::State* ExperimentalRegExpDfa::RunSeeds() {
+  // This mirrors `NfaInterpreter::RunActiveThreads`, with the register
+  // operations left out: `stack_` plays the role of the active threads and
+  // `visited_` the one of `pc_last_input_index_`.
+  key_.clear();
+  stack_.assign(seeds_.rbegin(), seeds_.rend());
+  bool accepted = false;
+  ++generation_;
+
+  while (!stack_.empty()) {
+    Thread t = Decode(stack_.back());
+    stack_.pop_back();
+    while (true) {
+      uint32_t& visited =
+          visited_[2 * t.pc + (t.consumed_since_last_quantifier ? 1 : 0)];
+      if (visited == generation_) break;
+      visited = generation_;
+
+      const RegExpInstruction& inst = bytecode_[t.pc];
+      bool done = false;
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          key_.push_back(Encode(t));
+          done = true;
+          break;
+        case RegExpInstruction::FORK:
+          stack_.push_back(Encode(Thread{
+              inst.payload.pc, t.consumed_since_last_quantifier, t.start}));
+          ++t.pc;
+          break;
+        case RegExpInstruction::JMP:
+          t.pc = inst.payload.pc;
+          break;
+        case RegExpInstruction::ACCEPT:
+          // Threads with lower priority can only produce worse matches.
+          accepted = true;
+          stack_.clear();
+          done = true;
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+          if (inst.payload.register_index == 0) t.start = ThreadStart::kHere;
+          ++t.pc;
+          break;
+        case RegExpInstruction::CLEAR_REGISTER:
+        case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+          ++t.pc;
+          break;
+        case RegExpInstruction::BEGIN_LOOP:
+          t.consumed_since_last_quantifier = false;
+          ++t.pc;
+          break;
+        case RegExpInstruction::END_LOOP:
+          // Quantifier iterations must not match the empty string.
+          done = !t.consumed_since_last_quantifier;
+          ++t.pc;
+          break;
+        default:
+          UNREACHABLE();
+      }
+      if (done) break;
+    }
+  }
+  key_.push_back(accepted ? 1 : 0);
+
+  auto it = states_.find(base::VectorOf(key_));
+  if (it != states_.end()) return it->second;
+
+  const size_t class_count = class_bounds_.size();
+  cache_size_ += sizeof(State) + key_.size() * sizeof(uint32_t) +
+                 class_count * sizeof(State*) +
+                 sizeof(decltype(states_)::value_type);
+  if (cache_size_ > kMaxCacheSize) {
+    out_of_memory_ = true;
+    return nullptr;
+  }
+
+  uint32_t* key = zone_.AllocateArray<uint32_t>(key_.size());
+  std::copy(key_.begin(), key_.end(), key);
+  State** transitions = zone_.AllocateArray<State*>(class_count);
+  std::fill(transitions, transitions + class_count, nullptr);
+  State* state = zone_.New<State>(
+      State{base::Vector<const uint32_t>(key, key_.size()), transitions});
+  states_.emplace(state->key, state);
+  return state;
+}
+
+ExperimentalRegExpDfa::State* ExperimentalRegExpDfa::ComputeTransition(
+    State* state, int character_class) {
+  const base::uc16 c = class_bounds_[character_class];
+  seeds_.clear();
+  for (uint32_t bits : state->threads()) {
+    Thread t = Decode(bits);
+    const RegExpInstruction& inst = bytecode_[t.pc];
+    DCHECK_EQ(inst.opcode, RegExpInstruction::CONSUME_RANGE);
+    if (c < inst.payload.consume_range.min ||
+        c > inst.payload.consume_range.max) {
+      continue;
+    }
+    ++t.pc;
+    t.consumed_since_last_quantifier = true;
+    if (t.start == ThreadStart::kHere) t.start = ThreadStart::kEarlier;
+    seeds_.push_back(Encode(t));
+  }
+  State* next = RunSeeds();
+  if (next != nullptr) state->transitions[character_class] = next;
+  return next;
+}
+
+template <class Character>
+ExperimentalRegExpDfa::Result ExperimentalRegExpDfa::FindMatchEndImpl(
+    base::Vector<const Character> input, Search* search) {
+  DCHECK_LE(0, search->index_);
+  DCHECK_LE(search->index_, input.length());
+
+  if (out_of_memory_) return Result::kOutOfMemory;
+  if (start_state_ == nullptr) {
+    // Threads start out as if they had consumed a character, see
+    // `NfaInterpreter::NewEmptyThread`.
+    seeds_.clear();
+    seeds_.push_back(Encode(Thread{0, true, ThreadStart::kNotStarted}));
+    start_state_ = RunSeeds();
+    if (start_state_ == nullptr) return Result::kOutOfMemory;
+  }
+  if (search->state_ == nullptr) search->state_ = start_state_;
+
+  // As long as no match was found, every time the automaton is back in its
+  // start state, all threads that started at earlier positions have died, so
+  // the interpreter can restart there instead of at `start_index`. Once a
+  // match was found, its start is fixed and the restart position must stay
+  // at or before it.
+  State* state = search->state_;
+  int index = search->index_;
+  const int pause_index = index + kCharactersBetweenPauses;
+  Result result;
+  while (true) {
+    if (state == start_state_ && !search->found_match_) {
+      search->restart_index_ = index;
+    }
+    if (state->accepted()) {
+      search->found_match_ = true;
+      search->match_end_ = index;
+    }
+    if (state->is_dead() || index == input.length()) {
+      result = search->found_match_ ? Result::kMatch : Result::kNoMatch;
+      break;
+    }
+    if (index == pause_index) {
+      result = Result::kPaused;
+      break;
+    }
+
+    int character_class = CharacterClass(input[index]);
+    State* next = state->transitions[character_class];
+    if (next == nullptr) {
+      next = ComputeTransition(state, character_class);
+      if (next == nullptr) return Result::kOutOfMemory;
+    }
+    state = next;
+    ++index;
+  }
+  search->state_ = state;
+  search->index_ = index;
+  return result;
+}
+
+ExperimentalRegExpDfa::Result ExperimentalRegExpDfa::FindMatchEnd(
+    base::Vector<const uint8_t> input, Search* search) {
+  return FindMatchEndImpl(input, search);
+}
+
+ExperimentalRegExpDfa::Result ExperimentalRegExpDfa::FindMatchEnd(
+    base::Vector<const base::uc16> input, Search* search) {
+  return FindMatchEndImpl(input, search);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,191 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
+
+#include "src/base/functional.h"
+#include "src/base/strings.h"
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+#include "src/regexp/experimental/experimental-bytecode.h"
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone-containers.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+
+// A lazily built deterministic automaton for experimental regexp bytecode.
+//
+// A DFA state is the priority-ordered list of threads that the NFA
+// interpreter would have blocked on CONSUME_RANGE after some input prefix.
+// Since the interpreter deduplicates threads by pc and discards the threads
+// with lower priority than an ACCEPTing one, that list only depends on the
+// previous list and the next character, so states and transitions can be
+// computed on demand and reused. Scanning then costs a table lookup per
+// character instead of running every thread.
+//
+// The DFA only tracks where matches end. The interpreter still computes
+// capture registers, but only on the range reported by `FindMatchEnd`.
+// Programs with assertions or lookbehinds depend on context that a state does
+// not capture and are not supported.
+//
+// The DFA of an EXPERIMENTAL regexp is created when its bytecode is compiled
+// and kept in its data array, so that the states computed by one execution
+// are reused by the next ones. States are never freed, which keeps them valid
+// when a search is resumed after an interrupt that ran the same regexp.
+class ExperimentalRegExpDfa final {
+  struct State;
+
+ public:
+  static constexpr ExternalPointerTag kManagedTag = kExperimentalRegExpDfaTag;
+
+  // Whether `bytecode` only uses instructions the DFA can simulate.
+  static bool CanBeHandled(base::Vector<const RegExpInstruction> bytecode);
+
+  // `bytecode` is copied, so it may move afterwards.
+  explicit ExperimentalRegExpDfa(
+      base::Vector<const RegExpInstruction> bytecode);
+
+  enum class Result {
+    kMatch,
+    kNoMatch,
+    // The search scanned `kCharactersBetweenPauses` characters without
+    // finishing. The caller should handle interrupts and call `FindMatchEnd`
+    // again with the same `Search` to resume it.
+    kPaused,
+    // The cache grew past `kMaxCacheSize`; the caller has to fall back to the
+    // interpreter, now and in all later executions.
+    kOutOfMemory,
+  };
+
+  // The progress of one search for a match end.
+  class Search {
+   public:
+    explicit Search(int start_index) : index_(start_index) {}
+
+    // On `kMatch`, the end of the match the interpreter would find when
+    // starting at `start_index`.
+    int match_end() const { return match_end_; }
+    // On `kMatch`, a position at or before the start of the match from which
+    // the interpreter finds the same match, i.e. where no earlier-started
+    // thread is alive anymore.
+    int restart_index() const { return restart_index_; }
+
+   private:
+    friend class ExperimentalRegExpDfa;
+
+    State* state_ = nullptr;
+    int index_;
+    bool found_match_ = false;
+    int restart_index_ = 0;
+    int match_end_ = 0;
+  };
+
+  // Continues `search` on `input`. Since the input may move while a search is
+  // paused, it is passed again on every call.
+  Result FindMatchEnd(base::Vector<const uint8_t> input, Search* search);
+  Result FindMatchEnd(base::Vector<const base::uc16> input, Search* search);
+
+  // Upper bound for the memory used by states and transition tables.
+  static constexpr size_t kMaxCacheSize = 2 * MB;
+  // Number of characters scanned between two checks for interrupts.
+  static constexpr int kCharactersBetweenPauses = 1024;
+
+ private:
+  // Where a thread is relative to the start of the match it is building:
+  // still in the /.*?/ preamble, started at the current position (i.e. it
+  // executed SET_REGISTER_TO_CP 0 since the last character), or started at an
+  // earlier position.
+  enum class ThreadStart : uint8_t { kNotStarted, kHere, kEarlier };
+
+  struct Thread {
+    int pc;
+    bool consumed_since_last_quantifier;
+    ThreadStart start;
+  };
+
+  static uint32_t Encode(Thread thread) {
+    return static_cast<uint32_t>(thread.pc) << 3 |
+           static_cast<uint32_t>(thread.consumed_since_last_quantifier) << 2 |
+           static_cast<uint32_t>(thread.start);
+  }
+  static Thread Decode(uint32_t bits) {
+    return Thread{static_cast<int>(bits >> 3), ((bits >> 2) & 1) != 0,
+                  static_cast<ThreadStart>(bits & 3)};
+  }
+
+  struct State {
+    // Encoded blocked threads, sorted from high to low priority, followed by
+    // one word that is 1 if a thread ACCEPTed while computing this state.
+    base::Vector<const uint32_t> key;
+    // Successor states indexed by character class, nullptr if not computed
+    // yet.
+    State** transitions;
+
+    base::Vector<const uint32_t> threads() const {
+      return key.SubVector(0, key.length() - 1);
+    }
+    bool accepted() const { return key.last() != 0; }
+    bool is_dead() const { return key.length() == 1; }
+  };
+
+  struct KeyHash {
+    size_t operator()(base::Vector<const uint32_t> key) const {
+      return base::hash_range(key.begin(), key.end());
+    }
+  };
+  struct KeyEqual {
+    bool operator()(base::Vector<const uint32_t> a,
+                    base::Vector<const uint32_t> b) const {
+      return a == b;
+    }
+  };
+
+  template <class Character>
+  Result FindMatchEndImpl(base::Vector<const Character> input,
+                          Search* search);
+
+  int CharacterClass(base::uc16 c) const;
+
+  // Runs the threads in `seeds_` (high to low priority) until they block or
+  // ACCEPT, and returns the resulting state, or nullptr if the cache is full.
+  State* RunSeeds();
+  State* ComputeTransition(State* state, int character_class);
+
+  AccountingAllocator allocator_;
+  // Owns the states and transition tables, which live as long as the DFA.
+  Zone zone_;
+
+  ZoneVector<RegExpInstruction> bytecode_;
+
+  // Sorted lower bounds of the character classes: characters in one class
+  // are accepted by exactly the same CONSUME_RANGE instructions.
+  // There are at most 2^16 classes, so class indices fit into a uc16.
+  ZoneVector<base::uc16> class_bounds_;
+  base::uc16 one_byte_classes_[256];
+
+  ZoneUnorderedMap<base::Vector<const uint32_t>, State*, KeyHash, KeyEqual>
+      states_;
+  State* start_state_ = nullptr;
+  size_t cache_size_ = 0;
+
+  // Scratch space for `RunSeeds`.
+  ZoneVector<uint32_t> seeds_;
+  ZoneVector<uint32_t> stack_;
+  ZoneVector<uint32_t> key_;
+  // The generation in which a (pc, consumed_since_last_quantifier) pair was
+  // last visited, so that the visited set doesn't have to be cleared.
+  ZoneVector<uint32_t> visited_;
+  uint32_t generation_ = 0;
+
+  // Set once the cache is full, after which the DFA is not used anymore.
+  bool out_of_memory_ = false;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
@@ -12,6 +12,7 @@
 #include "src/flags/flags.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/string-inl.h"
+#include "src/regexp/experimental/experimental-dfa.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/zone/zone-allocator.h"
@@ -276,7 +277,8 @@ class NfaInterpreter {
  public:
   NfaInterpreter(Isolate* isolate, RegExp::CallOrigin call_origin,
                  Tagged<ByteArray> bytecode, int register_count_per_match,
-                 Tagged<String> input, int32_t input_index, Zone* zone)
+                 Tagged<String> input, int32_t input_index,
+                 ExperimentalRegExpDfa* dfa, Zone* zone)
       : isolate_(isolate),
         call_origin_(call_origin),
         bytecode_object_(bytecode),
@@ -286,6 +288,7 @@ class NfaInterpreter {
         input_object_(input),
         input_(ToCharacterVector<Character>(input, no_gc_)),
         input_index_(input_index),
+        input_end_(input_.length()),
         clock(0),
         pc_last_input_index_(
             zone->AllocateArray<LastInputIndex>(bytecode->length()),
@@ -299,6 +302,7 @@ class NfaInterpreter {
         lookbehind_pc_(0, zone),
         filter_groups_pc_(std::nullopt),
         lookbehind_table_(0, zone),
+        dfa_(dfa),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
@@ -355,6 +359,7 @@ class NfaInterpreter {
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(),
               LastInputIndex());
+    DCHECK_IMPLIES(dfa_ != nullptr, lookbehind_pc_.is_empty());
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -552,6 +557,36 @@ class NfaInterpreter {
       best_match_thread_ = std::nullopt;
     }
 
+    // Let the DFA find out whether and where the next match ends, so that the
+    // threads below only run on the input that the match covers.
+    input_end_ = input_.length();
+    if (dfa_ != nullptr) {
+      ExperimentalRegExpDfa::Search search(input_index_);
+      ExperimentalRegExpDfa::Result result;
+      while ((result = dfa_->FindMatchEnd(input_, &search)) ==
+             ExperimentalRegExpDfa::Result::kPaused) {
+        // This may move the input, which is why it is passed on every call.
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+      switch (result) {
+        case ExperimentalRegExpDfa::Result::kNoMatch:
+          return RegExp::kInternalRegExpSuccess;
+        case ExperimentalRegExpDfa::Result::kMatch:
+          DCHECK_LE(input_index_, search.restart_index());
+          DCHECK_LE(search.restart_index(), search.match_end());
+          input_index_ = search.restart_index();
+          input_end_ = search.match_end();
+          break;
+        case ExperimentalRegExpDfa::Result::kPaused:
+          UNREACHABLE();
+        case ExperimentalRegExpDfa::Result::kOutOfMemory:
+          // Keep using the interpreter alone for the remaining matches.
+          dfa_ = nullptr;
+          break;
+      }
+    }
+
     // The lookbehind threads need to be executed before the thread of their
     // parent (lookbehind or main expression). The order of the bytecode (see
     // also `BytecodeAssembler`) ensures that they need to be executed from last
@@ -574,7 +609,7 @@ class NfaInterpreter {
     //   Threads with low priority have been aborted earlier, and the remaining
     //   threads are blocked here, so the latter simply means that
     //   `blocked_threads_` is empty.
-    while (input_index_ != input_.length() &&
+    while (input_index_ != input_end_ &&
            !(FoundMatch() && blocked_threads_.is_empty())) {
       DCHECK(active_threads_.is_empty());
       base::uc16 input_char = input_[input_index_];
@@ -596,6 +631,7 @@ class NfaInterpreter {
       if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
     }
 
+    DCHECK_IMPLIES(input_end_ != input_.length(), FoundMatch());
     return RegExp::kInternalRegExpSuccess;
   }
 
@@ -1027,6 +1063,10 @@ class NfaInterpreter {
   base::Vector<const Character> input_;
   int input_index_;
 
+  // The end of the input that the current `FindNextMatch` consumes. Smaller
+  // than the input length if the DFA already found where the match ends.
+  int input_end_;
+
   // Global clock counting the total of executed instructions.
   uint64_t clock;
 
@@ -1088,6 +1128,11 @@ class NfaInterpreter {
 
   uint64_t memory_consumption_per_thread_;
 
+  // Finds match ends ahead of the threads if the bytecode allows it, see
+  // `FindNextMatch`. Owned by the regexp, or by the caller for one-shot
+  // executions, since its states are reused across executions.
+  ExperimentalRegExpDfa* dfa_;
+
   Zone* zone_;
 };
 
@@ -1097,20 +1142,20 @@ int ExperimentalRegExpInterpreter::FindMatches(
     Isolate* isolate, RegExp::CallOrigin call_origin,
     Tagged<ByteArray> bytecode, int register_count_per_match,
     Tagged<String> input, int start_index, int32_t* output_registers,
-    int output_register_count, Zone* zone) {
+    int output_register_count, ExperimentalRegExpDfa* dfa, Zone* zone) {
   DCHECK(input->IsFlat());
   DisallowGarbageCollection no_gc;
 
   if (input->GetFlatContent(no_gc).IsOneByte()) {
     NfaInterpreter<uint8_t> interpreter(isolate, call_origin, bytecode,
                                         register_count_per_match, input,
-                                        start_index, zone);
+                                        start_index, dfa, zone);
     return interpreter.FindMatches(output_registers, output_register_count);
   } else {
     DCHECK(input->GetFlatContent(no_gc).IsTwoByte());
     NfaInterpreter<base::uc16> interpreter(isolate, call_origin, bytecode,
                                            register_count_per_match, input,
-                                           start_index, zone);
+                                           start_index, dfa, zone);
     return interpreter.FindMatches(output_registers, output_register_count);
   }
 }
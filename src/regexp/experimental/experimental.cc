@@ -6,7 +6,9 @@
 
 #include "src/common/assert-scope.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/objects/managed-inl.h"
 #include "src/regexp/experimental/experimental-compiler.h"
+#include "src/regexp/experimental/experimental-dfa.h"
 #include "src/regexp/experimental/experimental-interpreter.h"
 #include "src/regexp/regexp-parser.h"
 #include "src/utils/ostreams.h"
@@ -49,7 +51,10 @@ bool ExperimentalRegExp::IsCompiled(DirectHandle<JSRegExp> re,
 #endif
 
   static constexpr bool kIsLatin1 = true;
-  return re->bytecode(kIsLatin1) != Smi::FromInt(JSRegExp::kUninitializedValue);
+  // A DFA dropped for serialization is rebuilt by Compile.
+  return re->bytecode(kIsLatin1) !=
+             Smi::FromInt(JSRegExp::kUninitializedValue) &&
+         !IsUndefined(re->experimental_dfa(), isolate);
 }
 
 template <class T>
@@ -105,6 +110,48 @@ base::Optional<CompilationResult> CompileImpl(Isolate* isolate,
 
 }  // namespace
 
+base::Vector<RegExpInstruction> AsInstructionSequence(
+    Tagged<ByteArray> raw_bytes) {
+  RegExpInstruction* inst_begin =
+      reinterpret_cast<RegExpInstruction*>(raw_bytes->begin());
+  int inst_num = raw_bytes->length() / sizeof(RegExpInstruction);
+  DCHECK_EQ(sizeof(RegExpInstruction) * inst_num, raw_bytes->length());
+  return base::Vector<RegExpInstruction>(inst_begin, inst_num);
+}
+
+namespace {
+
+// Returns a DFA for `bytecode`, or null if it is disabled or cannot handle the
+// bytecode.
+std::unique_ptr<ExperimentalRegExpDfa> NewDfa(Tagged<ByteArray> bytecode) {
+  base::Vector<RegExpInstruction> instructions =
+      AsInstructionSequence(bytecode);
+  if (!v8_flags.experimental_regexp_engine_dfa ||
+      !ExperimentalRegExpDfa::CanBeHandled(instructions)) {
+    return nullptr;
+  }
+  return std::make_unique<ExperimentalRegExpDfa>(instructions);
+}
+
+// The DFA is kept with the bytecode, so that the states computed by one
+// execution are reused by the next ones.
+void SetDfa(Isolate* isolate, DirectHandle<JSRegExp> re,
+            Tagged<ByteArray> bytecode) {
+  std::unique_ptr<ExperimentalRegExpDfa> dfa = NewDfa(bytecode);
+  if (!dfa) {
+    re->set_experimental_dfa(Smi::FromInt(JSRegExp::kUninitializedValue));
+    return;
+  }
+  // States are added lazily up to the cache limit, so report that limit
+  // rather than the size of the initially empty DFA.
+  DirectHandle<Managed<ExperimentalRegExpDfa>> managed_dfa =
+      Managed<ExperimentalRegExpDfa>::From(
+          isolate, ExperimentalRegExpDfa::kMaxCacheSize, std::move(dfa));
+  re->set_experimental_dfa(*managed_dfa);
+}
+
+}  // namespace
+
 bool ExperimentalRegExp::Compile(Isolate* isolate, DirectHandle<JSRegExp> re) {
   DCHECK(v8_flags.enable_experimental_regexp_engine);
   DCHECK_EQ(re->type_tag(), JSRegExp::EXPERIMENTAL);
@@ -112,6 +159,13 @@ bool ExperimentalRegExp::Compile(Isolate* isolate, DirectHandle<JSRegExp> re) {
   if (v8_flags.verify_heap) re->JSRegExpVerify(isolate);
 #endif
 
+  static constexpr bool kIsLatin1 = true;
+  if (IsUndefined(re->experimental_dfa(), isolate)) {
+    // Only the DFA was dropped for serialization, the bytecode is still there.
+    SetDfa(isolate, re, Cast<ByteArray>(re->bytecode(kIsLatin1)));
+    return true;
+  }
+
   DirectHandle<String> source(re->source(), isolate);
   if (v8_flags.trace_experimental_regexp_engine) {
     StdoutStream{} << "Compiling experimental regexp " << *source << std::endl;
@@ -126,25 +180,18 @@ bool ExperimentalRegExp::Compile(Isolate* isolate, DirectHandle<JSRegExp> re) {
 
   re->set_bytecode_and_trampoline(isolate, compilation_result->bytecode);
   re->set_capture_name_map(compilation_result->capture_name_map);
+  SetDfa(isolate, re, *compilation_result->bytecode);
 
   return true;
 }
 
-base::Vector<RegExpInstruction> AsInstructionSequence(
-    Tagged<ByteArray> raw_bytes) {
-  RegExpInstruction* inst_begin =
-      reinterpret_cast<RegExpInstruction*>(raw_bytes->begin());
-  int inst_num = raw_bytes->length() / sizeof(RegExpInstruction);
-  DCHECK_EQ(sizeof(RegExpInstruction) * inst_num, raw_bytes->length());
-  return base::Vector<RegExpInstruction>(inst_begin, inst_num);
-}
-
 namespace {
 
 int32_t ExecRawImpl(Isolate* isolate, RegExp::CallOrigin call_origin,
                     Tagged<ByteArray> bytecode, Tagged<String> subject,
                     int capture_count, int32_t* output_registers,
-                    int32_t output_register_count, int32_t subject_index) {
+                    int32_t output_register_count, int32_t subject_index,
+                    ExperimentalRegExpDfa* dfa) {
   DisallowGarbageCollection no_gc;
   // TODO(cbruni): remove once gcmole is fixed.
   DisableGCMole no_gc_mole;
@@ -157,7 +204,7 @@ int32_t ExecRawImpl(Isolate* isolate, RegExp::CallOrigin call_origin,
   Zone zone(isolate->allocator(), ZONE_NAME);
   result = ExperimentalRegExpInterpreter::FindMatches(
       isolate, call_origin, bytecode, register_count_per_match, subject,
-      subject_index, output_registers, output_register_count, &zone);
+      subject_index, output_registers, output_register_count, dfa, &zone);
   return result;
 }
 
@@ -178,10 +225,19 @@ int32_t ExperimentalRegExp::ExecRaw(
 
   static constexpr bool kIsLatin1 = true;
   Tagged<ByteArray> bytecode = Cast<ByteArray>(regexp->bytecode(kIsLatin1));
+  Tagged<Object> dfa = regexp->experimental_dfa();
+  if (IsUndefined(dfa, isolate)) {
+    // The DFA was dropped for serialization and has to be rebuilt on the
+    // heap, which the runtime does before retrying.
+    DCHECK_EQ(call_origin, RegExp::kFromJs);
+    return RegExp::kInternalRegExpRetry;
+  }
 
-  return ExecRawImpl(isolate, call_origin, bytecode, subject,
-                     regexp->capture_count(), output_registers,
-                     output_register_count, subject_index);
+  return ExecRawImpl(
+      isolate, call_origin, bytecode, subject, regexp->capture_count(),
+      output_registers, output_register_count, subject_index,
+      IsForeign(dfa) ? Cast<Managed<ExperimentalRegExpDfa>>(dfa)->raw()
+                     : nullptr);
 }
 
 int32_t ExperimentalRegExp::MatchForCallFromJs(
@@ -283,11 +339,15 @@ int32_t ExperimentalRegExp::OneshotExecRaw(Isolate* isolate,
       CompileImpl(isolate, regexp);
   if (!compilation_result.has_value()) return RegExp::kInternalRegExpException;
 
+  // The bytecode is not kept, so neither is its DFA.
+  std::unique_ptr<ExperimentalRegExpDfa> dfa =
+      NewDfa(*compilation_result->bytecode);
+
   DisallowGarbageCollection no_gc;
   return ExecRawImpl(isolate, RegExp::kFromRuntime,
                      *compilation_result->bytecode, *subject,
                      regexp->capture_count(), output_registers,
-                     output_register_count, subject_index);
+                     output_register_count, subject_index, dfa.get());
 }
 
 MaybeHandle<Object> ExperimentalRegExp::OneshotExec(
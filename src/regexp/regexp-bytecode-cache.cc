@@ -0,0 +1,87 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/flags/flags.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+RegExpBytecodeCache::Key RegExpBytecodeCache::MakeKey(
+    base::Vector<const uint8_t> pattern, RegExpFlags flags, bool is_one_byte,
+    uint32_t backtrack_limit) {
+  return Key{std::vector<base::uc16>(pattern.begin(), pattern.end()), flags,
+             is_one_byte, backtrack_limit};
+}
+
+// static
+RegExpBytecodeCache::Key RegExpBytecodeCache::MakeKey(
+    base::Vector<const base::uc16> pattern, RegExpFlags flags,
+    bool is_one_byte, uint32_t backtrack_limit) {
+  return Key{std::vector<base::uc16>(pattern.begin(), pattern.end()), flags,
+             is_one_byte, backtrack_limit};
+}
+
+size_t RegExpBytecodeCache::KeyHash::operator()(const Key& key) const {
+  return base::Hasher{}
+      .AddRange(key.pattern.begin(), key.pattern.end())
+      .Add(static_cast<int>(key.flags))
+      .Add(key.is_one_byte)
+      .Add(key.backtrack_limit)
+      .hash();
+}
+
+// static
+size_t RegExpBytecodeCache::SizeOf(const Key& key, const Entry& entry) {
+  size_t size = sizeof(Key) + sizeof(Entry) +
+                key.pattern.size() * sizeof(base::uc16) +
+                entry.bytecode.size();
+  for (const NamedCapture& capture : entry.named_captures) {
+    size += sizeof(NamedCapture) + capture.name.size() * sizeof(base::uc16);
+  }
+  return size;
+}
+
+bool RegExpBytecodeCache::Lookup(const Key& key, Entry* entry) {
+  base::MutexGuard guard(&mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return false;
+  *entry = it->second;
+  return true;
+}
+
+void RegExpBytecodeCache::Insert(Key key, Entry entry) {
+  const size_t size = SizeOf(key, entry);
+  base::MutexGuard guard(&mutex_);
+  // Patterns seen first are kept; a process that compiles many distinct
+  // patterns shouldn't keep growing this cache.
+  if (size_in_bytes_ + size >
+      v8_flags.regexp_shared_bytecode_cache_size_kb.value() * size_t{KB}) {
+    return;
+  }
+  if (entries_.emplace(std::move(key), std::move(entry)).second) {
+    size_in_bytes_ += size;
+  }
+}
+
+void RegExpBytecodeCache::Clear() {
+  base::MutexGuard guard(&mutex_);
+  entries_.clear();
+  size_in_bytes_ = 0;
+}
+
+size_t RegExpBytecodeCache::size_in_bytes() {
+  base::MutexGuard guard(&mutex_);
+  return size_in_bytes_;
+}
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(RegExpBytecodeCache,
+                                GetProcessWideRegExpBytecodeCache)
+
+}  // namespace internal
+}  // namespace v8
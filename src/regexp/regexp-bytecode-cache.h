@@ -0,0 +1,89 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/base/strings.h"
+#include "src/base/vector.h"
+#include "src/regexp/regexp-flags.h"
+
+namespace v8 {
+namespace internal {
+
+// A process-wide cache of irregexp bytecode, shared by all isolates.
+//
+// Bytecode only consists of immediates and relative jumps, so unlike native
+// regexp code it doesn't refer to anything isolate-specific and can be copied
+// into any heap. Isolates that compile the same patterns (e.g. workers running
+// the same library) thus only parse and compile each of them once per
+// process. Native code is still compiled per isolate when a regexp tiers up.
+class V8_EXPORT_PRIVATE RegExpBytecodeCache final {
+ public:
+  struct Key {
+    std::vector<base::uc16> pattern;
+    RegExpFlags flags;
+    bool is_one_byte;
+    uint32_t backtrack_limit;
+
+    bool operator==(const Key& other) const {
+      return pattern == other.pattern &&
+             static_cast<int>(flags) == static_cast<int>(other.flags) &&
+             is_one_byte == other.is_one_byte &&
+             backtrack_limit == other.backtrack_limit;
+    }
+  };
+
+  struct NamedCapture {
+    std::vector<base::uc16> name;
+    int index;
+  };
+
+  struct Entry {
+    std::vector<uint8_t> bytecode;
+    int register_count;
+    // The backtrack limit the bytecode was compiled with, which may be lower
+    // than the one in the key if the regexp can fall back to the experimental
+    // engine.
+    uint32_t backtrack_limit;
+    // Sorted by index.
+    std::vector<NamedCapture> named_captures;
+  };
+
+  static Key MakeKey(base::Vector<const uint8_t> pattern, RegExpFlags flags,
+                     bool is_one_byte, uint32_t backtrack_limit);
+  static Key MakeKey(base::Vector<const base::uc16> pattern, RegExpFlags flags,
+                     bool is_one_byte, uint32_t backtrack_limit);
+
+  // Copies the entry for `key` into `entry` and returns true if there is one.
+  bool Lookup(const Key& key, Entry* entry);
+  // Adds an entry unless the cache would grow beyond
+  // --regexp-shared-bytecode-cache-size-kb.
+  void Insert(Key key, Entry entry);
+
+  void Clear();
+  size_t size_in_bytes();
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  static size_t SizeOf(const Key& key, const Entry& entry);
+
+  base::Mutex mutex_;
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+  size_t size_in_bytes_ = 0;
+};
+
+V8_EXPORT_PRIVATE RegExpBytecodeCache* GetProcessWideRegExpBytecodeCache();
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
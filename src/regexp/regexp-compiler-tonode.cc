@@ -827,6 +827,11 @@ void RegExpDisjunction::RationalizeConsecutiveAtoms(RegExpCompiler* compiler) {
   ZoneList<RegExpTree*>* alternatives = this->alternatives();
   int length = alternatives->length();
   const bool ignore_case = IsIgnoreCase(compiler->flags());
+  // Usually only runs of three or more atoms are worth factoring. Large
+  // disjunctions also factor pairs, so that their alternatives end up with
+  // distinct first characters and ChoiceNode::Emit can dispatch on them.
+  const int min_run_length =
+      length >= kMinChoicesForFirstCharacterDispatch ? 2 : 3;
 
   int write_posn = 0;
   int i = 0;
@@ -865,7 +870,7 @@ void RegExpDisjunction::RationalizeConsecutiveAtoms(RegExpCompiler* compiler) {
       prefix_length = std::min(prefix_length, alt_atom->length());
       i++;
     }
-    if (i > first_with_prefix + 2) {
+    if (i - first_with_prefix >= min_run_length) {
       // Found worthwhile run of alternatives with common prefix of at least one
       // character.  The sorting function above did not sort on more than one
       // character for reasons of correctness, but there may still be a longer
@@ -4,6 +4,8 @@
 
 #include "src/regexp/regexp-compiler.h"
 
+#include <memory>
+
 #include "src/base/safe_conversions.h"
 #include "src/execution/isolate.h"
 #include "src/objects/fixed-array-inl.h"
@@ -2587,6 +2589,41 @@ RegExpNode* TextNode::GetSuccessorOfOmnivorousTextNode(
   return ranges->at(0).IsEverything(max_char) ? on_success() : nullptr;
 }
 
+ZoneList<CharacterRange>* TextNode::GetFirstCharacterRanges(
+    RegExpCompiler* compiler) {
+  if (read_backward()) return nullptr;
+  if (elements()->is_empty()) return nullptr;
+  if (IsIgnoreCase(compiler->flags())) return nullptr;
+  if (IsEitherUnicode(compiler->flags())) return nullptr;
+  ZoneList<CharacterRange>* result =
+      zone()->New<ZoneList<CharacterRange>>(2, zone());
+  TextElement elm = elements()->at(0);
+  if (elm.text_type() == TextElement::ATOM) {
+    result->Add(CharacterRange::Singleton(elm.atom()->data()[0]), zone());
+  } else {
+    DCHECK_EQ(elm.text_type(), TextElement::CLASS_RANGES);
+    RegExpClassRanges* node = elm.class_ranges();
+    ZoneList<CharacterRange>* ranges = node->ranges(zone());
+    CharacterRange::Canonicalize(ranges);
+    if (node->is_negated()) {
+      CharacterRange::Negate(ranges, result, zone());
+    } else {
+      result->AddAll(*ranges, zone());
+    }
+  }
+  // Drop what lies beyond the code units of the subject.
+  const base::uc32 max_char = MaxCodeUnit(compiler->one_byte());
+  int length = 0;
+  for (int i = 0; i < result->length(); i++) {
+    CharacterRange range = result->at(i);
+    if (range.from() > max_char) break;
+    result->at(length++) =
+        CharacterRange::Range(range.from(), std::min(range.to(), max_char));
+  }
+  result->Rewind(length);
+  return result;
+}
+
 // Finds the fixed match length of a sequence of nodes that goes from
 // this alternative and back to this choice node.  If there are variable
 // length nodes or other complications in the way then return a sentinel
@@ -3114,6 +3151,8 @@ void ChoiceNode::Emit(RegExpCompiler* compiler, Trace* trace) {
     return;
   }
 
+  if (EmitFirstCharacterDispatch(compiler, trace)) return;
+
   RecursionCheck rc(compiler);
 
   PreloadState preload;
@@ -3241,6 +3280,134 @@ int ChoiceNode::EmitOptimizedUnanchoredSearch(RegExpCompiler* compiler,
   return eats_at_least;
 }
 
+namespace {
+
+// Code units from `from` up to the `from` of the next interval, which all
+// select the same alternative, or none if `alternative` is -1.
+struct DispatchInterval {
+  base::uc32 from;
+  int alternative;
+};
+
+// A range of code units that alternative `alternative` can start with.
+struct FirstCharacterRange {
+  CharacterRange range;
+  int alternative;
+};
+
+int CompareFirstCharacterRanges(const FirstCharacterRange* a,
+                                const FirstCharacterRange* b) {
+  if (a->range.from() < b->range.from()) return -1;
+  if (a->range.from() > b->range.from()) return 1;
+  return 0;
+}
+
+// Binary search over the intervals [start, end) on the current character.
+void EmitDispatchTree(RegExpMacroAssembler* masm,
+                      ZoneList<DispatchInterval>* intervals, int start,
+                      int end, Label* alternative_labels, Label* on_failure) {
+  if (end - start == 1) {
+    int alternative = intervals->at(start).alternative;
+    masm->GoTo(alternative == -1 ? on_failure
+                                 : &alternative_labels[alternative]);
+    return;
+  }
+  int mid = start + (end - start) / 2;
+  Label above;
+  masm->CheckCharacterGT(intervals->at(mid).from - 1, &above);
+  EmitDispatchTree(masm, intervals, start, mid, alternative_labels,
+                   on_failure);
+  masm->Bind(&above);
+  EmitDispatchTree(masm, intervals, mid, end, alternative_labels, on_failure);
+}
+
+}  // namespace
+
+// Large disjunctions of literals like /foo|bar|baz|.../ are tried one
+// alternative after the other, each with its own quick check, so the cost
+// grows with the number of alternatives. If every alternative is a text node
+// and no two of them can start with the same code unit (which
+// RegExpDisjunction::RationalizeConsecutiveAtoms arranges for atoms), at most
+// one alternative can match, and a binary search on the first code unit
+// selects it directly.
+bool ChoiceNode::EmitFirstCharacterDispatch(RegExpCompiler* compiler,
+                                            Trace* trace) {
+  int choice_count = alternatives_->length();
+  if (choice_count < kMinChoicesForFirstCharacterDispatch) return false;
+  if (!compiler->optimize() || read_backward()) return false;
+  if (trace->stop_node() != nullptr) return false;
+
+  Zone* zone = compiler->zone();
+  ZoneList<FirstCharacterRange>* ranges =
+      zone->New<ZoneList<FirstCharacterRange>>(choice_count, zone);
+  for (int i = 0; i < choice_count; i++) {
+    GuardedAlternative alternative = alternatives_->at(i);
+    if (alternative.guards() != nullptr) return false;
+    ZoneList<CharacterRange>* first_characters =
+        alternative.node()->GetFirstCharacterRanges(compiler);
+    if (first_characters == nullptr) return false;
+    for (int j = 0; j < first_characters->length(); j++) {
+      ranges->Add(FirstCharacterRange{first_characters->at(j), i}, zone);
+    }
+  }
+  ranges->Sort(&CompareFirstCharacterRanges);
+
+  // Split the code units into intervals that select the same alternative.
+  ZoneList<DispatchInterval>* intervals =
+      zone->New<ZoneList<DispatchInterval>>(2 * ranges->length() + 1, zone);
+  auto add_interval = [=](base::uc32 from, int alternative) {
+    if (intervals->is_empty() || intervals->last().alternative != alternative) {
+      intervals->Add(DispatchInterval{from, alternative}, zone);
+    }
+  };
+  base::uc32 next = 0;
+  for (int i = 0; i < ranges->length(); i++) {
+    CharacterRange range = ranges->at(i).range;
+    // Alternatives with overlapping first characters need backtracking.
+    if (range.from() < next) return false;
+    if (range.from() > next) add_interval(next, -1);
+    add_interval(range.from(), ranges->at(i).alternative);
+    next = range.to() + 1;
+  }
+  if (next <= MaxCodeUnit(compiler->one_byte())) add_interval(next, -1);
+
+  RegExpMacroAssembler* macro_assembler = compiler->macro_assembler();
+  RecursionCheck rc(compiler);
+
+  if (trace->characters_preloaded() != 1) {
+    macro_assembler->LoadCurrentCharacter(
+        trace->cp_offset(), trace->backtrack(),
+        trace->bound_checked_up_to() < 1, 1,
+        EatsAtLeast(trace->at_start() == Trace::FALSE_VALUE));
+  }
+  std::unique_ptr<Label[]> alternative_labels(new Label[choice_count]);
+  std::unique_ptr<bool[]> is_reachable(new bool[choice_count]());
+  for (int i = 0; i < intervals->length(); i++) {
+    int alternative = intervals->at(i).alternative;
+    if (alternative != -1) is_reachable[alternative] = true;
+  }
+  EmitDispatchTree(macro_assembler, intervals, 0, intervals->length(),
+                   alternative_labels.get(), trace->backtrack());
+
+  int new_flush_budget = trace->flush_budget() / choice_count;
+  for (int i = 0; i < choice_count; i++) {
+    // Alternatives that can't match any code unit are never jumped to.
+    if (!is_reachable[i]) continue;
+    macro_assembler->Bind(&alternative_labels[i]);
+    Trace new_trace(*trace);
+    new_trace.set_characters_preloaded(1);
+    new_trace.set_bound_checked_up_to(
+        std::max(trace->bound_checked_up_to(), 1));
+    new_trace.quick_check_performed()->Clear();
+    if (not_at_start_) new_trace.set_at_start(Trace::FALSE_VALUE);
+    if (new_trace.actions() != nullptr) {
+      new_trace.set_flush_budget(new_flush_budget);
+    }
+    alternatives_->at(i).node()->Emit(compiler, &new_trace);
+  }
+  return true;
+}
+
 void ChoiceNode::EmitChoices(RegExpCompiler* compiler,
                              AlternativeGenerationList* alt_gens,
                              int first_choice, Trace* trace,
@@ -47,6 +47,10 @@ constexpr int kMaxLookaheadForBoyerMoore = 8;
 // In a 3-character pattern you can maximally step forwards 3 characters
 // at a time, which is not always enough to pay for the extra logic.
 constexpr int kPatternTooShortForBoyerMoore = 2;
+// Disjunctions with at least this many alternatives are factored until the
+// alternatives start with distinct characters, and then dispatch on the first
+// character instead of trying the alternatives one after the other.
+constexpr int kMinChoicesForFirstCharacterDispatch = 8;
 
 }  // namespace regexp_compiler_constants
 
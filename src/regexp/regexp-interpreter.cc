@@ -6,6 +6,8 @@
 
 #include "src/regexp/regexp-interpreter.h"
 
+#include <algorithm>
+
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
 #include "src/execution/isolate.h"
@@ -397,7 +399,7 @@ IrregexpInterpreter::Result RawMatch(
     Tagged<String> subject_string, base::Vector<const Char> subject,
     int* output_registers, int output_register_count, int total_register_count,
     int current, uint32_t current_char, RegExp::CallOrigin call_origin,
-    const uint32_t backtrack_limit) {
+    const uint32_t backtrack_limit, uint32_t* backtrack_count_out) {
   DisallowGarbageCollection no_gc;
 
 #if V8_USE_COMPUTED_GOTO
@@ -535,6 +537,9 @@ IrregexpInterpreter::Result RawMatch(
     BYTECODE(POP_BT) {
       static_assert(JSRegExp::kNoBacktrackLimit == 0);
       if (++backtrack_count == backtrack_limit) {
+        if (backtrack_count_out != nullptr) {
+          *backtrack_count_out = backtrack_count;
+        }
         int return_code = LoadPacked24Signed(insn);
         return static_cast<IrregexpInterpreter::Result>(return_code);
       }
@@ -555,11 +560,17 @@ IrregexpInterpreter::Result RawMatch(
     BYTECODE(FAIL) {
       isolate->counters()->regexp_backtracks()->AddSample(
           static_cast<int>(backtrack_count));
+      if (backtrack_count_out != nullptr) {
+        *backtrack_count_out = backtrack_count;
+      }
       return IrregexpInterpreter::FAILURE;
     }
     BYTECODE(SUCCEED) {
       isolate->counters()->regexp_backtracks()->AddSample(
           static_cast<int>(backtrack_count));
+      if (backtrack_count_out != nullptr) {
+        *backtrack_count_out = backtrack_count;
+      }
       registers.CopyToOutputRegisters();
       return IrregexpInterpreter::SUCCESS;
     }
@@ -1061,29 +1072,69 @@ IrregexpInterpreter::Result RawMatch(
 #undef BC_LABEL
 #undef V8_USE_COMPUTED_GOTO
 
+// Charges a finished interpreted execution against the tier-up ticks of
+// `regexp`. Every execution costs one tick, plus one more for every
+// --regexp-tier-up-work-per-tick units of work it did. The work is the number
+// of subject characters the match got past plus weighted backtracks, so cheap
+// regexps stay in the interpreter for --regexp-tier-up-ticks executions while
+// expensive ones tier up after a single one.
+void ChargeTierUpTicks(Isolate* isolate, Tagged<JSRegExp> regexp,
+                       int subject_length, int start_position,
+                       IrregexpInterpreter::Result result,
+                       const int* output_registers, uint32_t backtrack_count) {
+  // Executions that are retried or fall back to another engine are not
+  // charged.
+  if (result != IrregexpInterpreter::SUCCESS &&
+      result != IrregexpInterpreter::FAILURE) {
+    return;
+  }
+  // The match end for successful matches. Failed matches had to try every
+  // start position up to the end of the subject.
+  const int end = result == IrregexpInterpreter::SUCCESS ? output_registers[1]
+                                                         : subject_length;
+  const int64_t work =
+      std::max(end - start_position, 0) +
+      int64_t{backtrack_count} * JSRegExp::kTierUpBacktrackWork;
+  const int64_t work_per_tick =
+      std::max(v8_flags.regexp_tier_up_work_per_tick.value(), 1);
+  const int ticks =
+      static_cast<int>(std::min<int64_t>(1 + work / work_per_tick, kMaxInt));
+  const int work_sample = static_cast<int>(std::min<int64_t>(work, kMaxInt));
+  isolate->counters()->regexp_interpreter_work()->AddSample(work_sample);
+
+  const bool marked = regexp->TierUpTick(ticks);
+  if (marked) isolate->counters()->regexp_tier_up_by_cost()->Increment();
+  if (v8_flags.trace_regexp_tier_up) {
+    PrintF("JSRegExp object %p was interpreted with work %d (%u backtracks) "
+           "costing %d tick(s)%s\n",
+           reinterpret_cast<void*>(regexp->ptr()), work_sample, backtrack_count,
+           ticks, marked ? ", marking it for tier-up" : "");
+  }
+}
+
 }  // namespace
 
 // static
 IrregexpInterpreter::Result IrregexpInterpreter::Match(
     Isolate* isolate, Tagged<JSRegExp> regexp, Tagged<String> subject_string,
     int* output_registers, int output_register_count, int start_position,
-    RegExp::CallOrigin call_origin) {
-  if (v8_flags.regexp_tier_up) regexp->TierUpTick();
-
+    RegExp::CallOrigin call_origin, uint32_t* backtrack_count) {
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(subject_string);
   Tagged<ByteArray> code_array = Cast<ByteArray>(regexp->bytecode(is_one_byte));
   int total_register_count = regexp->max_register_count();
 
   return MatchInternal(isolate, code_array, subject_string, output_registers,
                        output_register_count, total_register_count,
-                       start_position, call_origin, regexp->backtrack_limit());
+                       start_position, call_origin, regexp->backtrack_limit(),
+                       backtrack_count);
 }
 
 IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     Isolate* isolate, Tagged<ByteArray> code_array,
     Tagged<String> subject_string, int* output_registers,
     int output_register_count, int total_register_count, int start_position,
-    RegExp::CallOrigin call_origin, uint32_t backtrack_limit) {
+    RegExp::CallOrigin call_origin, uint32_t backtrack_limit,
+    uint32_t* backtrack_count) {
   DCHECK(subject_string->IsFlat());
 
   // TODO(chromium:1262676): Remove this CHECK once fixed.
@@ -1110,7 +1161,7 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     return RawMatch(isolate, code_array, subject_string, subject_vector,
                     output_registers, output_register_count,
                     total_register_count, start_position, previous_char,
-                    call_origin, backtrack_limit);
+                    call_origin, backtrack_limit, backtrack_count);
   } else {
     DCHECK(subject_content.IsTwoByte());
     base::Vector<const base::uc16> subject_vector =
@@ -1119,7 +1170,7 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     return RawMatch(isolate, code_array, subject_string, subject_vector,
                     output_registers, output_register_count,
                     total_register_count, start_position, previous_char,
-                    call_origin, backtrack_limit);
+                    call_origin, backtrack_limit, backtrack_count);
   }
 }
 
@@ -1149,8 +1200,17 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchForCallFromJs(
     return IrregexpInterpreter::RETRY;
   }
 
-  return Match(isolate, regexp_obj, subject_string, output_registers,
-               output_register_count, start_position, call_origin);
+  uint32_t backtrack_count = 0;
+  Result result =
+      Match(isolate, regexp_obj, subject_string, output_registers,
+            output_register_count, start_position, call_origin,
+            &backtrack_count);
+  if (v8_flags.regexp_tier_up) {
+    ChargeTierUpTicks(isolate, regexp_obj, subject_string->length(),
+                      start_position, result, output_registers,
+                      backtrack_count);
+  }
+  return result;
 }
 
 #endif  // !COMPILING_IRREGEXP_FOR_EXTERNAL_EMBEDDER
@@ -1159,9 +1219,18 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchForCallFromRuntime(
     Isolate* isolate, DirectHandle<JSRegExp> regexp,
     DirectHandle<String> subject_string, int* output_registers,
     int output_register_count, int start_position) {
-  return Match(isolate, *regexp, *subject_string, output_registers,
-               output_register_count, start_position,
-               RegExp::CallOrigin::kFromRuntime);
+  uint32_t backtrack_count = 0;
+  Result result = Match(isolate, *regexp, *subject_string, output_registers,
+                        output_register_count, start_position,
+                        RegExp::CallOrigin::kFromRuntime, &backtrack_count);
+  // Interrupts handled during the match may have moved the regexp, so only
+  // dereference the handles again afterwards.
+  if (v8_flags.regexp_tier_up) {
+    ChargeTierUpTicks(isolate, *regexp, subject_string->length(),
+                      start_position, result, output_registers,
+                      backtrack_count);
+  }
+  return result;
 }
 
 }  // namespace internal
@@ -189,6 +189,13 @@ class RegExpNode : public ZoneObject {
       RegExpCompiler* compiler) {
     return nullptr;
   }
+  // Only returns the canonical ranges of code units that can be consumed first
+  // for a forward, case-sensitive text node, i.e. the node fails on all other
+  // code units at the current position.
+  virtual ZoneList<CharacterRange>* GetFirstCharacterRanges(
+      RegExpCompiler* compiler) {
+    return nullptr;
+  }
 
   // Collects information on the possible code units (mod 128) that can match if
   // we look forward.  This is used for a Boyer-Moore-like string searching
@@ -440,6 +447,8 @@ class TextNode : public SeqRegExpNode {
   int GreedyLoopTextLength() override;
   RegExpNode* GetSuccessorOfOmnivorousTextNode(
       RegExpCompiler* compiler) override;
+  ZoneList<CharacterRange>* GetFirstCharacterRanges(
+      RegExpCompiler* compiler) override;
   void FillInBMInfo(Isolate* isolate, int offset, int budget,
                     BoyerMooreLookahead* bm, bool not_at_start) override;
   void CalculateOffsets();
@@ -654,6 +663,7 @@ class ChoiceNode : public RegExpNode {
                     PreloadState* preloads);
   void AssertGuardsMentionRegisters(Trace* trace);
   int EmitOptimizedUnanchoredSearch(RegExpCompiler* compiler, Trace* trace);
+  bool EmitFirstCharacterDispatch(RegExpCompiler* compiler, Trace* trace);
   Trace* EmitGreedyLoop(RegExpCompiler* compiler, Trace* trace,
                         AlternativeGenerationList* alt_gens,
                         PreloadState* preloads,
@@ -11,6 +11,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -85,6 +86,10 @@ class RegExpImpl final : public AllStatic {
 
   static bool CompileIrregexp(Isolate* isolate, DirectHandle<JSRegExp> re,
                               Handle<String> sample_subject, bool is_one_byte);
+  // Installs bytecode that another isolate compiled for the same pattern.
+  static void InstallCachedIrregexpBytecode(
+      Isolate* isolate, DirectHandle<JSRegExp> re, bool is_one_byte,
+      const RegExpBytecodeCache::Entry& entry);
   static inline bool EnsureCompiledIrregexp(Isolate* isolate,
                                             Handle<JSRegExp> re,
                                             Handle<String> sample_subject,
@@ -374,6 +379,30 @@ int RegExpImpl::AtomExecRaw(Isolate* isolate, DirectHandle<JSRegExp> regexp,
   DCHECK_LE(0, index);
   DCHECK_LE(index, subject->length());
 
+  if (String::CanSearchInPlace(*subject)) {
+    // Atoms don't need random access to the subject, so collect the matches
+    // in one pass over the segments of the rope instead of flattening it.
+    Handle<String> needle(regexp->atom_pattern(), isolate);
+    int needle_len = needle->length();
+    if (index + needle_len > subject->length()) return RegExp::RE_FAILURE;
+    // The start indices are stored in the first half of {output} and then
+    // spread out into (start, end) pairs, back to front.
+    int max_matches = output_size / 2;
+    int match_count = String::SearchInPlace(isolate, subject, needle, index,
+                                            output, max_matches);
+    for (int i = match_count - 1; i >= 0; i--) {
+      output[2 * i] = output[i];
+      output[2 * i + 1] = output[i] + needle_len;
+    }
+    // A full {output} of several matches means that the global cache will
+    // search again, starting after the last match. Flatten the subject then,
+    // so that it isn't walked from the root once more.
+    if (max_matches > 1 && match_count == max_matches) {
+      String::Flatten(isolate, subject);
+    }
+    return match_count;
+  }
+
   subject = String::Flatten(isolate, subject);
   DisallowGarbageCollection no_gc;  // ensure vectors stay valid
 
@@ -560,6 +589,30 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, DirectHandle<JSRegExp> re,
 
   Handle<String> pattern(re->source(), isolate);
   pattern = String::Flatten(isolate, pattern);
+
+  // Bytecode is isolate-independent, so it can come from and go to the
+  // process-wide cache. Native code is always compiled per isolate.
+  const bool use_shared_cache =
+      re->ShouldProduceBytecode() &&
+      v8_flags.regexp_shared_bytecode_cache_size_kb > 0;
+  RegExpBytecodeCache::Key cache_key;
+  if (use_shared_cache) {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = pattern->GetFlatContent(no_gc);
+    cache_key = content.IsOneByte()
+                    ? RegExpBytecodeCache::MakeKey(content.ToOneByteVector(),
+                                                   flags, is_one_byte,
+                                                   re->backtrack_limit())
+                    : RegExpBytecodeCache::MakeKey(content.ToUC16Vector(),
+                                                   flags, is_one_byte,
+                                                   re->backtrack_limit());
+    RegExpBytecodeCache::Entry entry;
+    if (GetProcessWideRegExpBytecodeCache()->Lookup(cache_key, &entry)) {
+      InstallCachedIrregexpBytecode(isolate, re, is_one_byte, entry);
+      return true;
+    }
+  }
+
   RegExpCompileData compile_data;
   if (!RegExpParser::ParseRegExpFromHeapString(isolate, &zone, pattern, flags,
                                                &compile_data)) {
@@ -615,6 +668,28 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, DirectHandle<JSRegExp> re,
   }
   data->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
 
+  if (use_shared_cache) {
+    DCHECK_EQ(compile_data.compilation_target,
+              RegExpCompilationTarget::kBytecode);
+    Tagged<ByteArray> bytecode = IrregexpByteCode(*data, is_one_byte);
+    RegExpBytecodeCache::Entry entry;
+    entry.bytecode.assign(bytecode->begin(),
+                          bytecode->begin() + bytecode->length());
+    entry.register_count = compile_data.register_count;
+    entry.backtrack_limit = backtrack_limit;
+    if (compile_data.named_captures != nullptr) {
+      // CreateCaptureNameMap sorted the captures by index.
+      for (const RegExpCapture* capture : *compile_data.named_captures) {
+        entry.named_captures.push_back(
+            {std::vector<base::uc16>(capture->name()->begin(),
+                                     capture->name()->end()),
+             capture->index()});
+      }
+    }
+    GetProcessWideRegExpBytecodeCache()->Insert(std::move(cache_key),
+                                                std::move(entry));
+  }
+
   if (v8_flags.trace_regexp_tier_up) {
     PrintF("JSRegExp object %p %s size: %d\n",
            reinterpret_cast<void*>(re->ptr()),
@@ -627,6 +702,42 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, DirectHandle<JSRegExp> re,
   return true;
 }
 
+void RegExpImpl::InstallCachedIrregexpBytecode(
+    Isolate* isolate, DirectHandle<JSRegExp> re, bool is_one_byte,
+    const RegExpBytecodeCache::Entry& entry) {
+  Factory* factory = isolate->factory();
+  const int length = static_cast<int>(entry.bytecode.size());
+  DirectHandle<ByteArray> bytecode = factory->NewByteArray(length);
+  MemCopy(bytecode->begin(), entry.bytecode.data(), length);
+
+  Handle<FixedArray> capture_name_map;
+  if (!entry.named_captures.empty()) {
+    const int count = static_cast<int>(entry.named_captures.size());
+    capture_name_map = factory->NewFixedArray(count * 2);
+    for (int i = 0; i < count; i++) {
+      const RegExpBytecodeCache::NamedCapture& capture =
+          entry.named_captures[i];
+      // See CreateCaptureNameMap for why the names are internalized.
+      DirectHandle<String> name =
+          factory->InternalizeString(base::VectorOf(capture.name));
+      capture_name_map->set(i * 2, *name);
+      capture_name_map->set(i * 2 + 1, Smi::FromInt(capture.index));
+    }
+  }
+
+  DirectHandle<FixedArray> data(Cast<FixedArray>(re->data()), isolate);
+  data->set(JSRegExp::bytecode_index(is_one_byte), *bytecode);
+  DirectHandle<Code> trampoline =
+      BUILTIN_CODE(isolate, RegExpInterpreterTrampoline);
+  data->set(JSRegExp::code_index(is_one_byte), trampoline->wrapper());
+  re->set_capture_name_map(capture_name_map);
+  if (entry.register_count > IrregexpMaxRegisterCount(*data)) {
+    SetIrregexpMaxRegisterCount(*data, entry.register_count);
+  }
+  data->set(JSRegExp::kIrregexpBacktrackLimit,
+            Smi::FromInt(entry.backtrack_limit));
+}
+
 int RegExpImpl::IrregexpMaxRegisterCount(Tagged<FixedArray> re) {
   return Smi::ToInt(re->get(JSRegExp::kIrregexpMaxRegisterCountIndex));
 }
@@ -737,8 +848,6 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
         case IrregexpInterpreter::RETRY:
           // The string has changed representation, and we must restart the
           // match.
-          // We need to reset the tier up to start over with compilation.
-          if (v8_flags.regexp_tier_up) regexp->ResetLastTierUpTick();
           is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
           EnsureCompiledIrregexp(isolate, regexp, subject, is_one_byte);
           break;
@@ -769,6 +878,9 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(
   // subject string length is equal or greater than the given heuristic value.
   if (v8_flags.regexp_tier_up &&
       subject->length() >= JSRegExp::kTierUpForSubjectLengthValue) {
+    if (!regexp->MarkedForTierUp()) {
+      isolate->counters()->regexp_tier_up_by_subject_length()->Increment();
+    }
     regexp->MarkTierUpForNextExec();
     if (v8_flags.trace_regexp_tier_up) {
       PrintF(
@@ -1078,11 +1190,10 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
     case JSRegExp::NOT_COMPILED:
       UNREACHABLE();
     case JSRegExp::ATOM: {
-      // ATOM regexps do not have a global loop, so we search for one match at
-      // a time.
+      // AtomExecRaw searches for as many matches as fit into the registers.
       static const int kAtomRegistersPerMatch = 2;
       registers_per_match_ = kAtomRegistersPerMatch;
-      register_array_size_ = registers_per_match_;
+      register_array_size_ = BatchRegisterCount();
       break;
     }
     case JSRegExp::IRREGEXP: {
@@ -1098,8 +1209,7 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
         register_array_size_ = registers_per_match_;
         max_matches_ = 1;
       } else {
-        register_array_size_ = std::max(
-            {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
+        register_array_size_ = BatchRegisterCount();
       }
       break;
     }
@@ -1112,8 +1222,7 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
       }
       registers_per_match_ =
           JSRegExp::RegistersForCaptureCount(regexp->capture_count());
-      register_array_size_ = std::max(
-          {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
+      register_array_size_ = BatchRegisterCount();
       break;
     }
   }
@@ -1138,6 +1247,13 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
   last_match[1] = 0;
 }
 
+int RegExpGlobalCache::BatchRegisterCount() const {
+  const int batch_size = subject_->length() >= kMinSubjectLengthForLargeBatch
+                             ? kLargeBatchRegisterCount
+                             : Isolate::kJSRegexpStaticOffsetsVectorSize;
+  return std::max(registers_per_match_, batch_size);
+}
+
 RegExpGlobalCache::~RegExpGlobalCache() {
   // Deallocate the register array if we allocated it in the constructor
   // (as opposed to using the existing jsregexp_static_offsets_vector).
@@ -191,8 +191,16 @@ class RegExpGlobalCache final {
 
   bool HasException() { return num_matches_ < 0; }
 
+  // Subjects of at least this many characters are searched in batches of up
+  // to kLargeBatchRegisterCount registers, so that subjects with many matches
+  // don't return from the regexp code after every few dozen of them.
+  static constexpr int kMinSubjectLengthForLargeBatch = 16 * KB;
+  static constexpr int kLargeBatchRegisterCount = 2 * KB;
+
  private:
   int AdvanceZeroLength(int last_index);
+  // The number of registers to fetch per call into the regexp code.
+  int BatchRegisterCount() const;
 
   int num_matches_;
   int max_matches_;
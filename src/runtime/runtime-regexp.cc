@@ -1216,6 +1216,9 @@ static Tagged<Object> SearchRegExpMultiple(
   // matches one at a time, so it's easier to tier-up to native code from the
   // start.
   if (v8_flags.regexp_tier_up && regexp->type_tag() == JSRegExp::IRREGEXP) {
+    if (!regexp->MarkedForTierUp()) {
+      isolate->counters()->regexp_tier_up_for_global_replace()->Increment();
+    }
     regexp->MarkTierUpForNextExec();
     if (v8_flags.trace_regexp_tier_up) {
       PrintF("Forcing tier-up of JSRegExp object %p in SearchRegExpMultiple\n",
@@ -1453,6 +1456,9 @@ V8_WARN_UNUSED_RESULT MaybeHandle<String> RegExpReplace(
     // matches one at a time, so it's easier to tier-up to native code from the
     // start.
     if (v8_flags.regexp_tier_up && regexp->type_tag() == JSRegExp::IRREGEXP) {
+      if (!regexp->MarkedForTierUp()) {
+        isolate->counters()->regexp_tier_up_for_global_replace()->Increment();
+      }
       regexp->MarkTierUpForNextExec();
       if (v8_flags.trace_regexp_tier_up) {
         PrintF("Forcing tier-up of JSRegExp object %p in RegExpReplace\n",
@@ -170,6 +170,17 @@ RUNTIME_FUNCTION(Runtime_StringReplaceOneCharWithString) {
   return isolate->StackOverflow();
 }
 
+RUNTIME_FUNCTION(Runtime_StringIndexOfUnchecked) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  Handle<String> receiver = args.at<String>(0);
+  Handle<String> search = args.at<String>(1);
+  int index = args.smi_value_at(2);
+  DCHECK_LE(0, index);
+  DCHECK_LE(index, receiver->length());
+  return Smi::FromInt(String::IndexOf(isolate, receiver, search, index));
+}
+
 RUNTIME_FUNCTION(Runtime_StringLastIndexOf) {
   HandleScope handle_scope(isolate);
   return String::LastIndexOf(isolate, args.at(0), args.at(1),
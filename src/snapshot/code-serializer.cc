@@ -42,6 +42,21 @@ AlignedCachedData::AlignedCachedData(const uint8_t* data, int length)
   }
 }
 
+namespace {
+
+// The decision that a function gets when it is deserialized. A Maglev compile
+// that is still pending in this isolate has nothing to wait for in the next
+// one, so the function can tier up to Maglev early right away.
+CachedTieringDecision TieringDecisionForCodeCache(
+    CachedTieringDecision decision) {
+  if (decision == CachedTieringDecision::kEarlyMaglevPending) {
+    return CachedTieringDecision::kEarlyMaglev;
+  }
+  return decision;
+}
+
+}  // namespace
+
 CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
     : Serializer(isolate, Snapshot::kDefaultSerializerFlags),
       source_hash_(source_hash) {}
@@ -179,7 +194,10 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
       }
       if (v8_flags.profile_guided_optimization) {
         cached_tiering_decision = sfi->cached_tiering_decision();
-        sfi->set_cached_tiering_decision(CachedTieringDecision::kPending);
+        sfi->set_cached_tiering_decision(
+            v8_flags.profile_guided_optimization_in_code_cache
+                ? TieringDecisionForCodeCache(cached_tiering_decision)
+                : CachedTieringDecision::kPending);
       }
     }
     SerializeGeneric(obj, slot_type);
@@ -18,6 +18,7 @@
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/snapshot/embedded/embedded-file-writer.h"
+#include "src/snapshot/read-only-serializer-deserializer.h"
 #include "src/snapshot/snapshot.h"
 #include "src/snapshot/static-roots-gen.h"
 
@@ -96,9 +97,15 @@ class SnapshotFileWriter {
 
   static void WriteSnapshotFileData(FILE* fp,
                                     v8::base::Vector<const uint8_t> blob) {
-    fprintf(
-        fp,
-        "alignas(kPointerAlignment) static const uint8_t blob_data[] = {\n");
+    if (i::v8_flags.map_read_only_snapshot) {
+      // The read-only snapshot is aligned relative to the start of the blob.
+      fprintf(fp, "alignas(%zu) static const uint8_t blob_data[] = {\n",
+              i::ro::kSegmentAlignment);
+    } else {
+      fprintf(
+          fp,
+          "alignas(kPointerAlignment) static const uint8_t blob_data[] = {\n");
+    }
     WriteBinaryContentsAsCArray(fp, blob);
     fprintf(fp, "};\n");
     fprintf(fp, "static const int blob_size = %d;\n", blob.length());
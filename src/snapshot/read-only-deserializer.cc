@@ -4,6 +4,7 @@
 
 #include "src/snapshot/read-only-deserializer.h"
 
+#include "src/base/platform/platform.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/read-only-heap.h"
@@ -13,6 +14,7 @@
 #include "src/snapshot/embedded/embedded-data-inl.h"
 #include "src/snapshot/read-only-serializer-deserializer.h"
 #include "src/snapshot/snapshot-data.h"
+#include "src/utils/allocation.h"
 
 namespace v8 {
 namespace internal {
@@ -43,6 +45,9 @@ class ReadOnlyHeapImageDeserializer final {
         case Bytecode::kSegment:
           DeserializeSegment();
           break;
+        case Bytecode::kAlignedSegment:
+          DeserializeAlignedSegment();
+          break;
         case Bytecode::kRelocateSegment:
           UNREACHABLE();  // Handled together with kSegment.
         case Bytecode::kReadOnlyRootsTable:
@@ -99,6 +104,60 @@ class ReadOnlyHeapImageDeserializer final {
     }
   }
 
+  void DeserializeAlignedSegment() {
+    CHECK(V8_STATIC_ROOTS_BOOL);
+    uint32_t page_index = source_->GetUint30();
+    ReadOnlyPageMetadata* page = PageAt(page_index);
+
+    Address start = page->area_start() + source_->GetUint30();
+    int size_in_bytes = source_->GetUint30();
+    CHECK_LE(start + size_in_bytes, page->area_end());
+    source_->Advance(static_cast<int>(source_->GetUint32()));
+
+    const uint8_t* contents = source_->data() + source_->position();
+    if (!TryMapSegment(start, contents, size_in_bytes)) {
+      MemCopy(reinterpret_cast<void*>(start), contents, size_in_bytes);
+    }
+    source_->Advance(size_in_bytes);
+  }
+
+  // Maps the OS pages that are fully covered by the segment from the snapshot
+  // blob and copies the rest. Mapped pages are shared with all processes that
+  // use the same blob until they are written to, and are only read from the
+  // file when they are first accessed. This only works if the blob is mapped
+  // from a file and the payload was laid out for it by the serializer.
+  bool TryMapSegment(Address start, const uint8_t* contents,
+                     int size_in_bytes) {
+    if (!can_map_segments_) return false;
+    if constexpr (base::OS::IsRemapPageSupported()) {
+      const size_t page_size = GetPlatformPageAllocator()->AllocatePageSize();
+      if (ro::kSegmentAlignment % page_size != 0) return false;
+      const Address end = start + size_in_bytes;
+      const Address map_start = RoundUp(start, page_size);
+      const Address map_end = RoundDown(end, page_size);
+      if (map_start >= map_end) return false;
+      const uint8_t* map_contents = contents + (map_start - start);
+      if (!IsAligned(reinterpret_cast<Address>(map_contents), page_size)) {
+        return false;
+      }
+      if (!base::OS::RemapPages(map_contents, map_end - map_start,
+                                reinterpret_cast<void*>(map_start),
+                                base::OS::MemoryPermission::kReadWrite)) {
+        // The blob isn't backed by a file, don't try again for other
+        // segments.
+        can_map_segments_ = false;
+        return false;
+      }
+      MemCopy(reinterpret_cast<void*>(start), contents, map_start - start);
+      MemCopy(reinterpret_cast<void*>(map_end), contents + (map_end - start),
+              end - map_end);
+      isolate_->counters()->read_only_snapshot_pages_mapped()->Increment(
+          static_cast<int>((map_end - map_start) / page_size));
+      return true;
+    }
+    return false;
+  }
+
   Address Decode(ro::EncodedTagged encoded) const {
     ReadOnlyPageMetadata* page = PageAt(encoded.page_index);
     return page->OffsetToAddress(encoded.offset * kTaggedSize);
@@ -146,6 +205,7 @@ class ReadOnlyHeapImageDeserializer final {
 
   SnapshotByteSource* const source_;
   Isolate* const isolate_;
+  bool can_map_segments_ = true;
 };
 
 ReadOnlyDeserializer::ReadOnlyDeserializer(Isolate* isolate,
@@ -31,6 +31,15 @@ enum Bytecode {
   //   ... segment byte stream
   kSegment,
   //
+  // kAlignedSegment parameters:
+  //   Uint30 page_index
+  //   Uint30 offset
+  //   Uint30 size_in_bytes
+  //   Uint32 padding_size_in_bytes
+  //   ... padding
+  //   ... segment byte stream
+  kAlignedSegment,
+  //
   // kRelocateSegment parameters:
   //   ... relocation byte stream
   kRelocateSegment,
@@ -44,6 +53,14 @@ enum Bytecode {
 static constexpr int kNumberOfBytecodes =
     static_cast<int>(kFinalizeReadOnlySpace) + 1;
 
+// With --map-read-only-snapshot, segments are emitted as kAlignedSegment such
+// that their contents have the same offset modulo kSegmentAlignment in the
+// snapshot payload as in their page. The payload itself is aligned to
+// kSegmentAlignment in the snapshot blob. If the blob is mapped from a file,
+// the deserializer can then map the contents into the read-only space instead
+// of copying them. This must be a multiple of the OS page size.
+static constexpr size_t kSegmentAlignment = 64 * KB;
+
 // Like std::vector<bool> but with a known underlying encoding.
 class BitSet final {
  public:
@@ -365,12 +365,25 @@ class ReadOnlyHeapImageSerializer {
   }
 
   void EmitSegment(const ReadOnlySegmentForSerialization* segment) {
-    sink_->Put(Bytecode::kSegment, "segment begin");
+    // Only pages at fixed addresses can be mapped from the snapshot.
+    const bool aligned =
+        V8_STATIC_ROOTS_BOOL && v8_flags.map_read_only_snapshot;
+    sink_->Put(aligned ? Bytecode::kAlignedSegment : Bytecode::kSegment,
+               "segment begin");
     sink_->PutUint30(IndexOf(segment->page), "page index");
     sink_->PutUint30(static_cast<uint32_t>(segment->segment_offset),
                      "segment start offset");
     sink_->PutUint30(static_cast<uint32_t>(segment->segment_size),
                      "segment byte size");
+    if (aligned) {
+      constexpr size_t kMask = ro::kSegmentAlignment - 1;
+      const size_t contents_position = sink_->Position() + kUInt32Size;
+      const uint32_t padding = static_cast<uint32_t>(
+          (segment->segment_start - contents_position) & kMask);
+      sink_->PutUint32(padding, "segment padding size");
+      sink_->PutN(static_cast<int>(padding), 0, "segment padding");
+      DCHECK_EQ(sink_->Position() & kMask, segment->segment_start & kMask);
+    }
     sink_->PutRaw(segment->contents.get(),
                   static_cast<int>(segment->segment_size), "page");
     if (!V8_STATIC_ROOTS_BOOL) {
@@ -153,7 +153,8 @@ void FixedArrayBuilder::EnsureCapacity(Isolate* isolate, int elements) {
       new_length *= 2;
     } while (new_length < required_length);
     DirectHandle<FixedArray> extended_array =
-        isolate->factory()->NewFixedArrayWithHoles(new_length);
+        isolate->factory()->NewFixedArrayWithHoles(
+            new_length, RuntimeAllocationSite::kArrayGrowth);
     FixedArray::CopyElements(isolate, *extended_array, 0, *array_, 0, length_);
     array_ = extended_array;
   }
@@ -212,7 +213,8 @@ MaybeDirectHandle<String> ReplacementStringBuilder::ToString() {
     DirectHandle<SeqOneByteString> seq;
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, seq,
-        isolate->factory()->NewRawOneByteString(character_count_));
+        isolate->factory()->NewRawOneByteString(
+            character_count_, RuntimeAllocationSite::kStringBuilder));
 
     DisallowGarbageCollection no_gc;
     uint8_t* char_buffer = seq->GetChars(no_gc);
@@ -224,7 +226,8 @@ MaybeDirectHandle<String> ReplacementStringBuilder::ToString() {
     DirectHandle<SeqTwoByteString> seq;
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, seq,
-        isolate->factory()->NewRawTwoByteString(character_count_));
+        isolate->factory()->NewRawTwoByteString(
+            character_count_, RuntimeAllocationSite::kStringBuilder));
 
     DisallowGarbageCollection no_gc;
     base::uc16* char_buffer = seq->GetChars(no_gc);
@@ -287,9 +290,15 @@ void IncrementalStringBuilder::Extend() {
   }
   DirectHandle<String> new_part;
   if (encoding_ == String::ONE_BYTE_ENCODING) {
-    new_part = factory()->NewRawOneByteString(part_length_).ToHandleChecked();
+    new_part = factory()
+                   ->NewRawOneByteString(part_length_,
+                                         RuntimeAllocationSite::kStringBuilder)
+                   .ToHandleChecked();
   } else {
-    new_part = factory()->NewRawTwoByteString(part_length_).ToHandleChecked();
+    new_part = factory()
+                   ->NewRawTwoByteString(part_length_,
+                                         RuntimeAllocationSite::kStringBuilder)
+                   .ToHandleChecked();
   }
   // Reuse the same handle to avoid being invalidated when exiting handle scope.
   set_current_part(new_part);
@@ -10,6 +10,7 @@
 // Comment inserted to prevent header reordering.
 #include <type_traits>
 
+#include "src/base/bits.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/strings/char-predicates-inl.h"
@@ -46,6 +47,79 @@ uint32_t StringHasher::GetTrivialHash(int length) {
   return String::CreateHashFieldValue(hash, String::HashFieldType::kHash);
 }
 
+#ifdef V8_USE_WIDE_STRING_HASH
+namespace detail {
+
+// Constants of the xxHash64 round and finalizer.
+constexpr uint64_t kWideHashPrime1 = 0x9E3779B185EBCA87u;
+constexpr uint64_t kWideHashPrime2 = 0xC2B2AE3D27D4EB4Fu;
+constexpr uint64_t kWideHashPrime3 = 0x165667B19E3779F9u;
+
+// Packs up to four characters into one 16-bit lane each, so that the one-byte
+// and two-byte representations of a string produce the same words. The lanes
+// are assembled explicitly rather than loaded, which keeps the result
+// independent of the host byte order (mksnapshot may run on a host of
+// different endianness than the target).
+template <typename uchar>
+V8_INLINE uint64_t ReadWideHashBlock(const uchar* chars, int count) {
+  DCHECK_LE(count, 4);
+  uint64_t block = 0;
+  for (int i = 0; i < count; i++) {
+    block |= uint64_t{chars[i]} << (16 * i);
+  }
+  return block;
+}
+
+V8_INLINE uint64_t WideHashRound(uint64_t acc, uint64_t block) {
+  acc += block * kWideHashPrime2;
+  acc = base::bits::RotateLeft64(acc, 31);
+  return acc * kWideHashPrime1;
+}
+
+}  // namespace detail
+
+template <typename uchar>
+uint32_t StringHasher::HashWide(const uchar* chars, int length,
+                                uint64_t seed) {
+  static_assert(kMinWideHashLength > String::kMaxIntegerIndexSize);
+  DCHECK_GE(length, kMinWideHashLength);
+  // Two independent accumulators let consecutive rounds overlap.
+  uint64_t acc0 = seed + detail::kWideHashPrime1 + detail::kWideHashPrime2;
+  uint64_t acc1 = seed + detail::kWideHashPrime2;
+  int i = 0;
+  for (; i + 8 <= length; i += 8) {
+    acc0 = detail::WideHashRound(acc0,
+                                 detail::ReadWideHashBlock(chars + i, 4));
+    acc1 = detail::WideHashRound(acc1,
+                                 detail::ReadWideHashBlock(chars + i + 4, 4));
+  }
+  if (i + 4 <= length) {
+    acc0 = detail::WideHashRound(acc0, detail::ReadWideHashBlock(chars + i, 4));
+    i += 4;
+  }
+  if (i < length) {
+    acc1 = detail::WideHashRound(
+        acc1, detail::ReadWideHashBlock(chars + i, length - i));
+  }
+
+  uint64_t hash = base::bits::RotateLeft64(acc0, 1) +
+                  base::bits::RotateLeft64(acc1, 7) +
+                  static_cast<uint64_t>(length);
+  hash ^= hash >> 33;
+  hash *= detail::kWideHashPrime2;
+  hash ^= hash >> 29;
+  hash *= detail::kWideHashPrime3;
+  hash ^= hash >> 32;
+
+  uint32_t running_hash = static_cast<uint32_t>(hash);
+  int32_t bits = static_cast<int32_t>(running_hash & String::HashBits::kMax);
+  // Ensure that the hash is kZeroHash, if the computed value is 0.
+  int32_t mask = (bits - 1) >> 31;
+  running_hash |= (kZeroHash & mask);
+  return running_hash;
+}
+#endif  // V8_USE_WIDE_STRING_HASH
+
 template <typename char_t>
 uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
                                             uint64_t seed) {
@@ -111,6 +185,13 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
     }
   }
 
+#ifdef V8_USE_WIDE_STRING_HASH
+  if (length >= kMinWideHashLength) {
+    return String::CreateHashFieldValue(HashWide(chars, length, seed),
+                                        String::HashFieldType::kHash);
+  }
+#endif  // V8_USE_WIDE_STRING_HASH
+
   // Non-index hash.
   uint32_t running_hash = static_cast<uint32_t>(seed);
   const uchar* end = &chars[length];
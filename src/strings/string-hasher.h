@@ -40,6 +40,17 @@ class V8_EXPORT_PRIVATE StringHasher final {
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
 
   static inline uint32_t GetTrivialHash(int length);
+
+#ifdef V8_USE_WIDE_STRING_HASH
+  // Strings of at least this length are hashed four characters at a time
+  // with a multiply-rotate mix instead of the one-at-a-time hash. This is
+  // longer than any integer index, so index detection is unaffected.
+  static const int kMinWideHashLength = 32;
+
+  template <typename uchar>
+  V8_INLINE static uint32_t HashWide(const uchar* chars, int length,
+                                     uint64_t seed);
+#endif  // V8_USE_WIDE_STRING_HASH
 };
 
 // Useful for std containers that require something ()'able.
@@ -0,0 +1,201 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-search-simd.h"
+
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+#include "src/codegen/cpu-features.h"
+
+#if V8_HOST_ARCH_X64
+#include <immintrin.h>
+#elif V8_HOST_ARCH_ARM64
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// "Generic SIMD" substring filtering: a vector of subject positions is
+// compared against the first pattern character, and the vector starting
+// {distance} characters later against the last pattern character. Positions
+// where both comparisons succeed are candidates. All loads stay within the
+// subject, since the last position tested is {end - 1 + distance}.
+
+template <typename Char>
+int ScalarFindFirstAndLast(const Char* subject, int index, int end,
+                           int distance, Char first, Char last) {
+  for (; index < end; index++) {
+    if (subject[index] == first && subject[index + distance] == last) {
+      return index;
+    }
+  }
+  return -1;
+}
+
+#if V8_HOST_ARCH_X64
+
+template <typename Char>
+int FindFirstAndLastSse2(const Char* subject, int index, int end,
+                         int distance, Char first, Char last) {
+  constexpr int kStep = sizeof(__m128i) / sizeof(Char);
+  __m128i first_vec, last_vec;
+  if constexpr (sizeof(Char) == 1) {
+    first_vec = _mm_set1_epi8(static_cast<char>(first));
+    last_vec = _mm_set1_epi8(static_cast<char>(last));
+  } else {
+    first_vec = _mm_set1_epi16(static_cast<int16_t>(first));
+    last_vec = _mm_set1_epi16(static_cast<int16_t>(last));
+  }
+  for (; index + kStep <= end; index += kStep) {
+    __m128i block_first =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject + index));
+    __m128i block_last = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + index + distance));
+    __m128i eq;
+    if constexpr (sizeof(Char) == 1) {
+      eq = _mm_and_si128(_mm_cmpeq_epi8(block_first, first_vec),
+                         _mm_cmpeq_epi8(block_last, last_vec));
+    } else {
+      eq = _mm_and_si128(_mm_cmpeq_epi16(block_first, first_vec),
+                         _mm_cmpeq_epi16(block_last, last_vec));
+    }
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(eq));
+    if (mask != 0) {
+      return index + static_cast<int>(base::bits::CountTrailingZeros32(mask) /
+                                      sizeof(Char));
+    }
+  }
+  return ScalarFindFirstAndLast(subject, index, end, distance, first, last);
+}
+
+// We don't compile with -mavx2, so the AVX2 loop gets its own target
+// attribute and is only called after a runtime check. MSVC can't do this
+// without /arch:AVX2 and sticks to SSE2.
+#if !defined(_MSC_VER)
+#define V8_STRING_SEARCH_AVX2 1
+
+template <typename Char>
+__attribute__((target("avx2"))) int FindFirstAndLastAvx2(
+    const Char* subject, int index, int end, int distance, Char first,
+    Char last) {
+  constexpr int kStep = sizeof(__m256i) / sizeof(Char);
+  __m256i first_vec, last_vec;
+  if constexpr (sizeof(Char) == 1) {
+    first_vec = _mm256_set1_epi8(static_cast<char>(first));
+    last_vec = _mm256_set1_epi8(static_cast<char>(last));
+  } else {
+    first_vec = _mm256_set1_epi16(static_cast<int16_t>(first));
+    last_vec = _mm256_set1_epi16(static_cast<int16_t>(last));
+  }
+  for (; index + kStep <= end; index += kStep) {
+    __m256i block_first =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(subject + index));
+    __m256i block_last = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(subject + index + distance));
+    __m256i eq;
+    if constexpr (sizeof(Char) == 1) {
+      eq = _mm256_and_si256(_mm256_cmpeq_epi8(block_first, first_vec),
+                            _mm256_cmpeq_epi8(block_last, last_vec));
+    } else {
+      eq = _mm256_and_si256(_mm256_cmpeq_epi16(block_first, first_vec),
+                            _mm256_cmpeq_epi16(block_last, last_vec));
+    }
+    uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+    if (mask != 0) {
+      return index + static_cast<int>(base::bits::CountTrailingZeros32(mask) /
+                                      sizeof(Char));
+    }
+  }
+  return ScalarFindFirstAndLast(subject, index, end, distance, first, last);
+}
+
+inline bool HasAvx2() {
+#if defined(V8_TARGET_ARCH_IA32) || defined(V8_TARGET_ARCH_X64)
+  return CpuFeatures::IsSupported(AVX2);
+#else
+  // Simulator builds don't probe for x64 features.
+  return false;
+#endif
+}
+#endif  // !defined(_MSC_VER)
+
+#elif V8_HOST_ARCH_ARM64
+
+// Narrows a comparison result to 4 bits per byte, the Neon equivalent of a
+// movemask, so that the first match can be found with a trailing zero count.
+inline uint64_t NibbleMask(uint8x16_t eq) {
+  uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+  return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+
+template <typename Char>
+int FindFirstAndLastNeon(const Char* subject, int index, int end, int distance,
+                         Char first, Char last) {
+  constexpr int kStep = sizeof(uint8x16_t) / sizeof(Char);
+  for (; index + kStep <= end; index += kStep) {
+    uint8x16_t eq;
+    if constexpr (sizeof(Char) == 1) {
+      uint8x16_t block_first = vld1q_u8(subject + index);
+      uint8x16_t block_last = vld1q_u8(subject + index + distance);
+      eq = vandq_u8(vceqq_u8(block_first, vdupq_n_u8(first)),
+                    vceqq_u8(block_last, vdupq_n_u8(last)));
+    } else {
+      uint16x8_t block_first = vld1q_u16(subject + index);
+      uint16x8_t block_last = vld1q_u16(subject + index + distance);
+      eq = vreinterpretq_u8_u16(
+          vandq_u16(vceqq_u16(block_first, vdupq_n_u16(first)),
+                    vceqq_u16(block_last, vdupq_n_u16(last))));
+    }
+    uint64_t mask = NibbleMask(eq);
+    if (mask != 0) {
+      return index + static_cast<int>(base::bits::CountTrailingZeros64(mask) /
+                                      (4 * sizeof(Char)));
+    }
+  }
+  return ScalarFindFirstAndLast(subject, index, end, distance, first, last);
+}
+
+#endif  // V8_HOST_ARCH_ARM64
+
+template <typename Char>
+int FindFirstAndLast(base::Vector<const Char> subject, int index, int distance,
+                     Char first, Char last) {
+  DCHECK_LE(0, index);
+  DCHECK_LT(0, distance);
+  const Char* chars = subject.begin();
+  int end = subject.length() - distance;
+#if V8_HOST_ARCH_X64
+#ifdef V8_STRING_SEARCH_AVX2
+  if (HasAvx2()) {
+    return FindFirstAndLastAvx2(chars, index, end, distance, first, last);
+  }
+#endif
+  return FindFirstAndLastSse2(chars, index, end, distance, first, last);
+#elif V8_HOST_ARCH_ARM64
+  return FindFirstAndLastNeon(chars, index, end, distance, first, last);
+#else
+  return ScalarFindFirstAndLast(chars, index, end, distance, first, last);
+#endif
+}
+
+}  // namespace
+
+int FindFirstAndLastCharacter(base::Vector<const uint8_t> subject, int index,
+                              int distance, uint8_t first, uint8_t last) {
+  return FindFirstAndLast(subject, index, distance, first, last);
+}
+
+int FindFirstAndLastCharacter(base::Vector<const base::uc16> subject,
+                              int index, int distance, base::uc16 first,
+                              base::uc16 last) {
+  return FindFirstAndLast(subject, index, distance, first, last);
+}
+
+#undef V8_STRING_SEARCH_AVX2
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,40 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRINGS_STRING_SEARCH_SIMD_H_
+#define V8_STRINGS_STRING_SEARCH_SIMD_H_
+
+#include "src/base/build_config.h"
+#include "src/base/strings.h"
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Whether FindFirstAndLastCharacter compares a vector of subject positions
+// per step on this host. Elsewhere, StringSearch keeps scanning for the first
+// pattern character with memchr.
+#if V8_HOST_ARCH_X64 || V8_HOST_ARCH_ARM64
+constexpr bool kHasSimdStringSearch = true;
+#else
+constexpr bool kHasSimdStringSearch = false;
+#endif
+
+// Returns the first position {i} in [index, subject.length() - distance) with
+// subject[i] == first and subject[i + distance] == last, or -1 if there is
+// none. Used to find candidate positions for a pattern of length
+// {distance + 1}, which rules out most positions whose first character
+// matches by accident.
+V8_EXPORT_PRIVATE int FindFirstAndLastCharacter(
+    base::Vector<const uint8_t> subject, int index, int distance,
+    uint8_t first, uint8_t last);
+V8_EXPORT_PRIVATE int FindFirstAndLastCharacter(
+    base::Vector<const base::uc16> subject, int index, int distance,
+    base::uc16 first, base::uc16 last);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_STRINGS_STRING_SEARCH_SIMD_H_
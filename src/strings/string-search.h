@@ -9,6 +9,7 @@
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
 #include "src/objects/string.h"
+#include "src/strings/string-search-simd.h"
 
 namespace v8 {
 namespace internal {
@@ -228,6 +229,26 @@ inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
   return -1;
 }
 
+// Returns the next position at or after {index} where the subject may contain
+// the pattern, or -1 if there is none. With SIMD, both the first and the last
+// pattern character are checked for a whole vector of positions at once, which
+// filters out far more false candidates than scanning for the first character
+// alone.
+template <typename PatternChar, typename SubjectChar>
+inline int FindCandidate(base::Vector<const PatternChar> pattern,
+                         base::Vector<const SubjectChar> subject, int index) {
+  DCHECK_GT(pattern.length(), 1);
+  if constexpr (kHasSimdStringSearch) {
+    // A two-byte pattern searched for in a one-byte subject only gets here if
+    // all of its characters are one-byte, so the casts are lossless.
+    return FindFirstAndLastCharacter(
+        subject, index, pattern.length() - 1,
+        static_cast<SubjectChar>(pattern[0]),
+        static_cast<SubjectChar>(pattern[pattern.length() - 1]));
+  }
+  return FindFirstCharacter(pattern, subject, index);
+}
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -275,7 +296,7 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
+    i = FindCandidate(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
     i++;
@@ -510,7 +531,7 @@ int StringSearch<PatternChar, SubjectChar>::InitialSearch(
   for (int i = index, n = subject.length() - pattern_length; i <= n; i++) {
     badness++;
     if (badness <= 0) {
-      i = FindFirstCharacter(pattern, subject, i);
+      i = FindCandidate(pattern, subject, i);
       if (i == -1) return -1;
       DCHECK_LE(i, n);
       int j = 1;
@@ -376,6 +376,20 @@ bool VirtualMemoryCage::InitReservation(
       params.page_allocator, allocatable_base, allocatable_size,
       params.page_size, params.page_initialization_mode,
       params.page_freeing_mode);
+
+  // Only cages that free pages by making them inaccessible keep the advice
+  // meaningful: decommitting remaps the pages without it, and discarded pages
+  // that stay accessible could be collapsed into huge pages again, which
+  // would make the resident memory exceed what the heap has committed.
+  // The advice goes through the page allocator that owns the reservation, so
+  // embedder allocators that don't support it are left alone.
+  if (v8_flags.huge_pages_for_heap &&
+      params.page_freeing_mode == base::PageFreeingMode::kMakeInaccessible &&
+      params.page_initialization_mode !=
+          base::PageInitializationMode::kAllocatedPagesMustBeZeroInitialized) {
+    params.page_allocator->AdviseHugePages(reinterpret_cast<void*>(base_),
+                                           size_);
+  }
   return true;
 }
 
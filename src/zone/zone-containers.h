@@ -163,16 +163,12 @@ class ZoneVector {
   ZoneVector& operator=(ZoneVector&& other) V8_NOEXCEPT {
     // Self-assignment would cause undefined behavior, and is probably a bug.
     DCHECK_NE(this, &other);
-    // Move-assigning vectors from different zones would have surprising
-    // lifetime semantics regardless of how we choose to implement it (keep
-    // the old zone? Take the new zone?).
-    if (zone_ == nullptr) {
-      zone_ = other.zone_;
-    } else {
-      DCHECK_EQ(zone_, other.zone_);
-    }
+    // The storage of {other} lives in {other.zone_}, so this vector takes
+    // over that zone along with it, and grows there from now on. This allows
+    // moving a vector to another zone by assigning a vector of that zone.
     for (T* p = data_; p < end_; p++) p->~T();
     if (data_) zone_->DeleteArray(data_, capacity());
+    zone_ = other.zone_;
     data_ = other.data_;
     end_ = other.end_;
     capacity_ = other.capacity_;
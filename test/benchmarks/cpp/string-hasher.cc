@@ -0,0 +1,70 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/strings/string-hasher-inl.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+using v8::internal::StringHasher;
+
+namespace {
+
+constexpr uint64_t kSeed = 0x5eed'5eed'5eed'5eed;
+
+// Builds a string of identifier-like characters of the requested length.
+template <typename Char>
+std::vector<Char> MakeString(size_t length) {
+  std::vector<Char> chars(length);
+  for (size_t i = 0; i < length; i++) {
+    chars[i] = static_cast<Char>('a' + (i * 7) % 26);
+  }
+  return chars;
+}
+
+template <typename Char>
+void BM_HashSequentialString(benchmark::State& state) {
+  std::vector<Char> chars = MakeString<Char>(state.range(0));
+  int length = static_cast<int>(chars.size());
+  for (auto _ : state) {
+    USE(_);
+    benchmark::DoNotOptimize(chars.data());
+    uint32_t hash =
+        StringHasher::HashSequentialString(chars.data(), length, kSeed);
+    benchmark::DoNotOptimize(hash);
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(Char));
+}
+
+void BM_HashArrayIndex(benchmark::State& state) {
+  std::string index = std::to_string(state.range(0));
+  int length = static_cast<int>(index.size());
+  for (auto _ : state) {
+    USE(_);
+    benchmark::DoNotOptimize(index.data());
+    uint32_t hash =
+        StringHasher::HashSequentialString(index.data(), length, kSeed);
+    benchmark::DoNotOptimize(hash);
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_HashSequentialString, uint8_t)
+    ->Arg(8)
+    ->Arg(31)
+    ->Arg(32)
+    ->Arg(128)
+    ->Arg(1024)
+    ->Arg(16383);
+BENCHMARK_TEMPLATE(BM_HashSequentialString, uint16_t)
+    ->Arg(8)
+    ->Arg(31)
+    ->Arg(32)
+    ->Arg(128)
+    ->Arg(1024)
+    ->Arg(16383);
+BENCHMARK(BM_HashArrayIndex)->Arg(7)->Arg(123456)->Arg(4294967294);
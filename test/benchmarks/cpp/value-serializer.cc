@@ -0,0 +1,222 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-exception.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-value-serializer.h"
+#include "src/base/logging.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+using BlobMode = v8::ValueSerializer::ArrayBufferBlobMode;
+
+// ArrayBuffers of at least this size are written out of band when a blob mode
+// is set.
+constexpr size_t kBlobThreshold = 16 * 1024;
+
+// Hands backing stores from the serializer to the deserializer, like an
+// embedder posting a message to a worker would.
+class BlobStore final : public v8::ValueSerializer::Delegate,
+                        public v8::ValueDeserializer::Delegate {
+ public:
+  explicit BlobStore(v8::Isolate* isolate) : isolate_(isolate) {}
+
+  void ThrowDataCloneError(v8::Local<v8::String> message) override {
+    isolate_->ThrowException(v8::Exception::Error(message));
+  }
+
+  v8::Maybe<uint32_t> GetArrayBufferBlobId(
+      v8::Isolate* isolate,
+      std::shared_ptr<v8::BackingStore> backing_store) override {
+    blobs_.push_back(std::move(backing_store));
+    return v8::Just(static_cast<uint32_t>(blobs_.size() - 1));
+  }
+
+  std::shared_ptr<v8::BackingStore> GetArrayBufferBlobFromId(
+      v8::Isolate* isolate, uint32_t blob_id) override {
+    CHECK_LT(blob_id, blobs_.size());
+    return blobs_[blob_id];
+  }
+
+ private:
+  v8::Isolate* const isolate_;
+  std::vector<std::shared_ptr<v8::BackingStore>> blobs_;
+};
+
+class ValueSerializerBenchmark
+    : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    v8::Isolate* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    context_.Reset(isolate, context);
+    context->Enter();
+
+    // Eight typed arrays sharing the total byte length given as the argument.
+    std::string source =
+        "Array.from({length: 8}, () => new Float64Array(" +
+        std::to_string(state.range(0) / 8 / sizeof(double)) + ").fill(1.5))";
+    v8::Local<v8::String> v8_source =
+        v8::String::NewFromUtf8(isolate, source.c_str()).ToLocalChecked();
+    v8::Local<v8::Script> script =
+        v8::Script::Compile(context, v8_source).ToLocalChecked();
+    payload_.Reset(isolate, script->Run(context).ToLocalChecked());
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    v8::HandleScope handle_scope(v8_isolate());
+    context_.Get(v8_isolate())->Exit();
+    payload_.Reset();
+    context_.Reset();
+  }
+
+ protected:
+  // Serializes and deserializes the payload once. The result replaces the
+  // payload, so that moved buffers are moved back on the next iteration.
+  void RoundTrip(std::optional<BlobMode> mode) {
+    v8::Isolate* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = context_.Get(isolate);
+    BlobStore blobs(isolate);
+
+    v8::ValueSerializer serializer(isolate, &blobs);
+    if (mode) serializer.SetArrayBufferBlobThreshold(kBlobThreshold, *mode);
+    serializer.WriteHeader();
+    CHECK(serializer.WriteValue(context, payload_.Get(isolate)).FromJust());
+    std::pair<uint8_t*, size_t> data = serializer.Release();
+
+    v8::ValueDeserializer deserializer(isolate, data.first, data.second,
+                                       &blobs);
+    CHECK(deserializer.ReadHeader(context).FromJust());
+    v8::Local<v8::Value> result =
+        deserializer.ReadValue(context).ToLocalChecked();
+    blobs.FreeBufferMemory(data.first);
+    payload_.Reset(isolate, result);
+  }
+
+ private:
+  v8::Global<v8::Context> context_;
+  v8::Global<v8::Value> payload_;
+};
+
+// Deserializes an array of records sharing one shape, as produced by an
+// embedder relaying a large JSON-like message.
+class ValueDeserializerRecordsBenchmark
+    : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    v8::Isolate* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    context_.Reset(isolate, context);
+    context->Enter();
+
+    std::string source =
+        "Array.from({length: " + std::to_string(state.range(0)) +
+        "}, (_, i) => ({id: i, name: 'user' + i, active: i % 2 == 0,"
+        " score: i * 0.5, tags: ['a', 'b']}))";
+    v8::Local<v8::String> v8_source =
+        v8::String::NewFromUtf8(isolate, source.c_str()).ToLocalChecked();
+    v8::Local<v8::Script> script =
+        v8::Script::Compile(context, v8_source).ToLocalChecked();
+    v8::ValueSerializer serializer(isolate);
+    serializer.WriteHeader();
+    CHECK(serializer.WriteValue(context, script->Run(context).ToLocalChecked())
+              .FromJust());
+    std::pair<uint8_t*, size_t> data = serializer.Release();
+    data_.assign(data.first, data.first + data.second);
+    free(data.first);
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    v8::HandleScope handle_scope(v8_isolate());
+    context_.Get(v8_isolate())->Exit();
+    context_.Reset();
+    data_.clear();
+  }
+
+ protected:
+  void Deserialize() {
+    v8::Isolate* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = context_.Get(isolate);
+    v8::ValueDeserializer deserializer(isolate, data_.data(), data_.size());
+    CHECK(deserializer.ReadHeader(context).FromJust());
+    v8::Local<v8::Value> result =
+        deserializer.ReadValue(context).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+
+ private:
+  v8::Global<v8::Context> context_;
+  std::vector<uint8_t> data_;
+};
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(ValueSerializerBenchmark, Inline)(benchmark::State& st) {
+  for (auto _ : st) {
+    USE(_);
+    RoundTrip(std::nullopt);
+  }
+  st.SetBytesProcessed(st.iterations() * st.range(0));
+}
+
+BENCHMARK_DEFINE_F(ValueSerializerBenchmark, BlobCopy)(benchmark::State& st) {
+  for (auto _ : st) {
+    USE(_);
+    RoundTrip(BlobMode::kCopy);
+  }
+  st.SetBytesProcessed(st.iterations() * st.range(0));
+}
+
+BENCHMARK_DEFINE_F(ValueSerializerBenchmark, BlobMove)(benchmark::State& st) {
+  for (auto _ : st) {
+    USE(_);
+    RoundTrip(BlobMode::kMove);
+  }
+  st.SetBytesProcessed(st.iterations() * st.range(0));
+}
+
+BENCHMARK_REGISTER_F(ValueSerializerBenchmark, Inline)
+    ->Arg(1 << 20)
+    ->Arg(16 << 20)
+    ->Arg(64 << 20);
+BENCHMARK_REGISTER_F(ValueSerializerBenchmark, BlobCopy)
+    ->Arg(1 << 20)
+    ->Arg(16 << 20)
+    ->Arg(64 << 20);
+BENCHMARK_REGISTER_F(ValueSerializerBenchmark, BlobMove)
+    ->Arg(1 << 20)
+    ->Arg(16 << 20)
+    ->Arg(64 << 20);
+
+BENCHMARK_DEFINE_F(ValueDeserializerRecordsBenchmark, Records)
+(benchmark::State& st) {
+  for (auto _ : st) {
+    USE(_);
+    Deserialize();
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+BENCHMARK_REGISTER_F(ValueDeserializerRecordsBenchmark, Records)
+    ->Arg(1000)
+    ->Arg(100000);
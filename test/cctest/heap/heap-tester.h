@@ -18,6 +18,7 @@
   V(CompactionPartiallyAbortedPageIntraAbortedPointers)     \
   V(CompactionPartiallyAbortedPageWithInvalidatedSlots)     \
   V(CompactionPartiallyAbortedPageWithRememberedSetEntries) \
+  V(CompactionPauseBudget)                                  \
   V(CompactionSpaceDivideMultiplePages)                     \
   V(CompactionSpaceDivideSinglePage)                        \
   V(InvalidatedSlotsAfterTrimming)                          \
@@ -13,6 +13,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-tester.h"
 #include "test/cctest/heap/heap-utils.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -432,6 +433,73 @@ HEAP_TEST(CompactionPartiallyAbortedPageWithRememberedSetEntries) {
   heap->RemoveNearHeapLimitCallback(reset_oom, 0u);
 }
 
+HEAP_TEST(CompactionPauseBudget) {
+  if (!v8_flags.compact || v8_flags.stress_compaction ||
+      v8_flags.stress_compaction_random || v8_flags.compact_on_every_full_gc ||
+      v8_flags.gc_experiment_less_compaction) {
+    return;
+  }
+  // Test that fragmented pages are only selected for evacuation when their
+  // estimated evacuation time fits into --compaction-pause-budget-ms.
+  ManualGCScope manual_gc_scope;
+  FLAG_VALUE_SCOPE(parallel_compaction, false);
+
+  const int objects_per_page = 100;
+  const int object_size = GetObjectSize(objects_per_page);
+
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope1(isolate);
+
+  heap::SealCurrentObjects(heap);
+
+  // Two pages with a single live object each, so that evacuating them
+  // releases a page.
+  Handle<FixedArray> survivors[2];
+  for (Handle<FixedArray>& survivor : survivors) {
+    HandleScope scope2(isolate);
+    CHECK(heap->old_space()->TryExpand(heap->main_thread_local_heap(),
+                                       AllocationOrigin::kRuntime));
+    auto handles = heap::CreatePadding(
+        heap,
+        static_cast<int>(MemoryChunkLayout::AllocatableMemoryInDataPage()),
+        AllocationType::kOld, object_size);
+    survivor = scope2.CloseAndEscape(handles.front());
+  }
+  PageMetadata* pages[] = {PageMetadata::FromHeapObject(*survivors[0]),
+                           PageMetadata::FromHeapObject(*survivors[1])};
+  CHECK_NE(pages[0], pages[1]);
+
+  // The pages are only fragmented after they have been swept.
+  heap::InvokeMajorGC(heap);
+  heap->EnsureSweepingCompleted(Heap::SweepingForcedFinalizationMode::kV8Only);
+  CHECK_EQ(pages[0], PageMetadata::FromHeapObject(*survivors[0]));
+  CHECK_EQ(pages[1], PageMetadata::FromHeapObject(*survivors[1]));
+
+  // At 100KB/ms, a budget of 0.01ms doesn't cover a single survivor.
+  for (int i = 0; i < 10; i++) {
+    heap->tracer()->AddCompactionEvent(1, 100 * KB);
+  }
+  {
+    FLAG_VALUE_SCOPE(compaction_pause_budget_ms, 0.01);
+    heap::InvokeMajorGC(heap);
+    heap->EnsureSweepingCompleted(
+        Heap::SweepingForcedFinalizationMode::kV8Only);
+  }
+  CHECK_EQ(pages[0], PageMetadata::FromHeapObject(*survivors[0]));
+  CHECK_EQ(pages[1], PageMetadata::FromHeapObject(*survivors[1]));
+
+  {
+    FLAG_VALUE_SCOPE(compaction_pause_budget_ms, 0);
+    heap::InvokeMajorGC(heap);
+    heap->EnsureSweepingCompleted(
+        Heap::SweepingForcedFinalizationMode::kV8Only);
+  }
+  CHECK_NE(pages[0], PageMetadata::FromHeapObject(*survivors[0]));
+  CHECK_NE(pages[1], PageMetadata::FromHeapObject(*survivors[1]));
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
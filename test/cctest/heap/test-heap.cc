@@ -3177,6 +3177,86 @@ TEST(OptimizedPretenuringNestedDoubleLiterals) {
   CHECK(CcTest::heap()->InOldSpace(double_array_handle_2->elements()));
 }
 
+static bool SkipRuntimeAllocationSiteTest() {
+  // MinorMS only records feedback for backing stores on promoted pages.
+  return !v8_flags.allocation_site_pretenuring || v8_flags.minor_ms ||
+         v8_flags.gc_global || v8_flags.stress_compaction ||
+         v8_flags.stress_incremental_marking || v8_flags.single_generation ||
+         v8_flags.stress_concurrent_allocation;
+}
+
+TEST(RuntimeAllocationSitePretenuring) {
+  CcTest::InitializeVM();
+  if (SkipRuntimeAllocationSiteTest()) return;
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  ManualGCScope manual_gc_scope;
+  GrowNewSpaceToMaximumCapacity(heap);
+
+  const int kLength = PretenuringHandler::kMinRuntimeAllocationSiteObjectSize;
+  Handle<FixedArray> survivors =
+      factory->NewFixedArray(kPretenureCreationCount);
+  for (int i = 0; i < kPretenureCreationCount; i++) {
+    DirectHandle<SeqOneByteString> string =
+        factory
+            ->NewRawOneByteString(kLength,
+                                  RuntimeAllocationSite::kStringBuilder)
+            .ToHandleChecked();
+    CHECK(Heap::InYoungGeneration(*string));
+    survivors->set(i, *string);
+  }
+  heap::InvokeMinorGC(heap);
+
+  // All the strings survived, so the next large ones go to old space.
+  CHECK_EQ(AllocationType::kOld,
+           heap->pretenuring_handler()
+               ->GetRuntimeAllocationSite(RuntimeAllocationSite::kStringBuilder)
+               ->GetAllocationType());
+  DirectHandle<SeqOneByteString> large =
+      factory
+          ->NewRawOneByteString(kLength, RuntimeAllocationSite::kStringBuilder)
+          .ToHandleChecked();
+  CHECK(heap->InOldSpace(*large));
+  // Small backing stores and other sites are not affected.
+  DirectHandle<SeqOneByteString> small =
+      factory->NewRawOneByteString(16, RuntimeAllocationSite::kStringBuilder)
+          .ToHandleChecked();
+  CHECK(Heap::InYoungGeneration(*small));
+  DirectHandle<FixedArray> array = factory->NewFixedArrayWithHoles(
+      kLength, RuntimeAllocationSite::kJsonParse);
+  CHECK(Heap::InYoungGeneration(*array));
+}
+
+TEST(RuntimeAllocationSiteDontTenureDyingObjects) {
+  CcTest::InitializeVM();
+  if (SkipRuntimeAllocationSiteTest()) return;
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  ManualGCScope manual_gc_scope;
+  GrowNewSpaceToMaximumCapacity(heap);
+
+  const int kLength =
+      PretenuringHandler::kMinRuntimeAllocationSiteObjectSize / kTaggedSize;
+  for (int i = 0; i < kPretenureCreationCount; i++) {
+    HandleScope inner_scope(isolate);
+    factory->NewFixedArrayWithHoles(kLength,
+                                    RuntimeAllocationSite::kArrayGrowth);
+  }
+  heap::InvokeMinorGC(heap);
+
+  CHECK_EQ(AllocationType::kYoung,
+           heap->pretenuring_handler()
+               ->GetRuntimeAllocationSite(RuntimeAllocationSite::kArrayGrowth)
+               ->GetAllocationType());
+  DirectHandle<FixedArray> array = factory->NewFixedArrayWithHoles(
+      kLength, RuntimeAllocationSite::kArrayGrowth);
+  CHECK(Heap::InYoungGeneration(*array));
+}
+
 // Test regular array literals allocation.
 TEST(OptimizedAllocationArrayLiterals) {
   v8_flags.allow_natives_syntax = true;
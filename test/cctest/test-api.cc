@@ -21081,6 +21081,144 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+class StringUtf8Sink : public v8::JSON::Utf8Sink {
+ public:
+  void Write(const char* data, size_t length) override {
+    CHECK_GT(length, 0);
+    output.append(data, length);
+  }
+
+  std::string output;
+};
+}  // namespace
+
+THREADED_TEST(JSONStringifyToUtf8) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  Local<Value> obj = CompileRun(
+      "({a: [1, 'caf\\u00e9'], b: '\\u20ac\\u{1f600}', c: '\\ud800',"
+      "  d: JSON.rawJSON('\"\\ud800\"')})");
+  {
+    StringUtf8Sink sink;
+    CHECK(v8::JSON::StringifyToUtf8(context.local(), obj, &sink).FromJust());
+    CHECK_EQ(std::string("{\"a\":[1,\"caf\xC3\xA9\"],"
+                         "\"b\":\"\xE2\x82\xAC\xF0\x9F\x98\x80\","
+                         "\"c\":\"\\ud800\",\"d\":\"\xEF\xBF\xBD\"}"),
+             sink.output);
+  }
+  {
+    StringUtf8Sink sink;
+    CHECK(v8::JSON::StringifyToUtf8(context.local(), v8_num(1), &sink,
+                                    v8_str("  "))
+              .FromJust());
+    CHECK_EQ(std::string("1"), sink.output);
+  }
+  {
+    // Long one-byte output is passed through in more than one chunk.
+    Local<Value> long_string = CompileRun("'x'.repeat(100000) + '\\u00ff'");
+    StringUtf8Sink sink;
+    CHECK(v8::JSON::StringifyToUtf8(context.local(), long_string, &sink)
+              .FromJust());
+    CHECK_EQ("\"" + std::string(100000, 'x') + "\xC3\xBF\"", sink.output);
+  }
+  {
+    StringUtf8Sink sink;
+    CHECK(!v8::JSON::StringifyToUtf8(context.local(),
+                                     v8::Undefined(context->GetIsolate()),
+                                     &sink)
+               .FromJust());
+    CHECK(sink.output.empty());
+  }
+  {
+    v8::TryCatch try_catch(context->GetIsolate());
+    Local<Value> cyclic = CompileRun("var cyclic = {}; cyclic.x = cyclic;");
+    StringUtf8Sink sink;
+    CHECK(
+        v8::JSON::StringifyToUtf8(context.local(), cyclic, &sink).IsNothing());
+    CHECK(try_catch.HasCaught());
+  }
+}
+
+namespace {
+Local<Value> ParseJSONInChunks(Local<Context> context,
+                               v8::JSON::ChunkBuffer* buffer,
+                               const char* input, size_t chunk_size) {
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(input);
+  size_t length = strlen(input);
+  for (size_t offset = 0; offset < length; offset += chunk_size) {
+    buffer->Append(data + offset, std::min(chunk_size, length - offset));
+  }
+  return buffer->Parse(context).ToLocalChecked();
+}
+}  // namespace
+
+THREADED_TEST(JSONChunkBufferAscii) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  const char* input = "{\"x\": [1, 2.5, \"a\\u00e9\\n\"], \"y\": {}}";
+  for (size_t chunk_size = 1; chunk_size <= strlen(input); chunk_size++) {
+    v8::JSON::ChunkBuffer buffer(v8::JSON::ChunkBuffer::Encoding::kUtf8);
+    Local<Value> obj =
+        ParseJSONInChunks(context.local(), &buffer, input, chunk_size);
+    context->Global()->Set(context.local(), v8_str("obj"), obj).FromJust();
+    ExpectString("JSON.stringify(obj)",
+                 "{\"x\":[1,2.5,\"a\xC3\xA9\\n\"],\"y\":{}}");
+  }
+}
+
+THREADED_TEST(JSONChunkBufferUtf8) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  // U+00E9, U+20AC and U+1F600 are encoded in two, three and four bytes, so
+  // every chunk size splits some of them across chunks.
+  const char* input =
+      "[\"\xC3\xA9\", \"\xE2\x82\xAC\", \"\xF0\x9F\x98\x80\"]";
+  for (size_t chunk_size = 1; chunk_size <= strlen(input); chunk_size++) {
+    v8::JSON::ChunkBuffer buffer(v8::JSON::ChunkBuffer::Encoding::kUtf8,
+                                 strlen(input));
+    Local<Value> obj =
+        ParseJSONInChunks(context.local(), &buffer, input, chunk_size);
+    context->Global()->Set(context.local(), v8_str("obj"), obj).FromJust();
+    ExpectBoolean("obj[0] === '\\u00e9'", true);
+    ExpectBoolean("obj[1] === '\\u20ac'", true);
+    ExpectBoolean("obj[2] === '\\u{1f600}'", true);
+  }
+}
+
+THREADED_TEST(JSONChunkBufferLatin1) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  // In Latin-1 mode, 0xE9 is a character of its own.
+  v8::JSON::ChunkBuffer buffer(v8::JSON::ChunkBuffer::Encoding::kOneByte);
+  Local<Value> obj =
+      ParseJSONInChunks(context.local(), &buffer, "\"caf\xE9\"", 2);
+  context->Global()->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectBoolean("obj === 'caf\\u00e9'", true);
+}
+
+THREADED_TEST(JSONChunkBufferErrors) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  v8::JSON::ChunkBuffer buffer(v8::JSON::ChunkBuffer::Encoding::kUtf8);
+  {
+    v8::TryCatch try_catch(context->GetIsolate());
+    CHECK(buffer.Parse(context.local()).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+  {
+    v8::TryCatch try_catch(context->GetIsolate());
+    const char kTruncated[] = "{\"x\": [1, 2";
+    buffer.Append(reinterpret_cast<const uint8_t*>(kTruncated),
+                  strlen(kTruncated));
+    CHECK(buffer.Parse(context.local()).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+  // The buffer can be reused after a failure.
+  Local<Value> obj = ParseJSONInChunks(context.local(), &buffer, "42", 1);
+  CHECK_EQ(42, obj->Int32Value(context.local()).FromJust());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
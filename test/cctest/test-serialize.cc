@@ -948,6 +948,45 @@ UNINITIALIZED_TEST(CustomSnapshotDataBlobWithIrregexpCodeClearCode) {
       v8::SnapshotCreator::FunctionCodeHandling::kClear);
 }
 
+UNINITIALIZED_TEST(CustomSnapshotDataBlobWithExperimentalRegExpDfa) {
+  DisableAlwaysOpt();
+  i::v8_flags.enable_experimental_regexp_engine = true;
+  i::v8_flags.experimental_regexp_engine_dfa = true;
+  const char* source =
+      "var re = /a+b/l;\n"
+      "function f() { return 'xxaab'.search(re); }\n"
+      "f(); f();\n";
+
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData data1 = CreateSnapshotDataBlob(source);
+
+  v8::Isolate::CreateParams params1;
+  params1.snapshot_blob = &data1;
+  params1.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate1 = TestSerializer::NewIsolate(params1);
+  {
+    v8::Isolate::Scope i_scope(isolate1);
+    v8::HandleScope h_scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope c_scope(context);
+    i::DirectHandle<i::JSRegExp> re =
+        Utils::OpenDirectHandle(*CompileRun("re").As<v8::RegExp>());
+    CHECK_EQ(re->type_tag(), JSRegExp::EXPERIMENTAL);
+    // The off-heap DFA is dropped for serialization, and rebuilt by the
+    // first execution.
+    CHECK(IsUndefined(re->experimental_dfa()));
+    v8::Maybe<int32_t> result =
+        CompileRun("f()")->Int32Value(isolate1->GetCurrentContext());
+    CHECK_EQ(2, result.FromJust());
+    CHECK(IsForeign(re->experimental_dfa()));
+  }
+  isolate1->Dispose();
+  delete[] data1.data;  // We can dispose of the snapshot blob now.
+  FreeCurrentEmbeddedBlob();
+}
+
 UNINITIALIZED_TEST(SnapshotChecksum) {
   DisableAlwaysOpt();
   const char* source1 = "function f() { return 42; }";
@@ -961,6 +1000,68 @@ UNINITIALIZED_TEST(SnapshotChecksum) {
   FreeCurrentEmbeddedBlob();
 }
 
+static int mapped_read_only_pages = 0;
+
+static int* LookupMappedReadOnlyPagesCounter(const char* name) {
+  if (strcmp(name, "c:V8.ReadOnlySnapshotPagesMapped") == 0) {
+    return &mapped_read_only_pages;
+  }
+  return nullptr;
+}
+
+UNINITIALIZED_TEST(CustomSnapshotDataBlobMappedReadOnlySpace) {
+  DisableAlwaysOpt();
+  i::v8_flags.map_read_only_snapshot = true;
+  const char* source = "function f() { return 42; }";
+
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData data = CreateSnapshotDataBlob(source);
+
+  // Load the blob from a file like embedders do, so that the read-only space
+  // can be mapped from it.
+  const char* kFileName = "test-serialize-mapped-read-only-space.bin";
+  std::unique_ptr<base::OS::MemoryMappedFile> file(
+      base::OS::MemoryMappedFile::create(kFileName, data.raw_size,
+                                         const_cast<char*>(data.data)));
+  CHECK_NOT_NULL(file);
+  v8::StartupData mapped_data = {static_cast<const char*>(file->memory()),
+                                 data.raw_size};
+  delete[] data.data;
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &mapped_data;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  params.counter_lookup_callback = LookupMappedReadOnlyPagesCounter;
+  mapped_read_only_pages = 0;
+
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+#ifndef V8_SNAPSHOT_COMPRESSION
+  // Without static roots the segments are copied and relocated instead.
+  if (V8_STATIC_ROOTS_BOOL && base::OS::IsRemapPageSupported()) {
+    CHECK_LT(0, mapped_read_only_pages);
+  } else {
+    CHECK_EQ(0, mapped_read_only_pages);
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope c_scope(context);
+    CHECK_EQ(42, CompileRun("f()")->Int32Value(context).FromJust());
+    // Exercise objects from all over the read-only space.
+    CHECK(CompileRun("[1, 2, 3].map(x => x * 2).join() === '2,4,6' && "
+                     "typeof Symbol.iterator === 'symbol' && "
+                     "String(undefined) === 'undefined'")
+              ->IsTrue());
+  }
+  isolate->Dispose();
+  file.reset();
+  base::OS::Remove(kFileName);
+  FreeCurrentEmbeddedBlob();
+}
+
 struct InternalFieldData {
   uint32_t data;
 };
@@ -3076,6 +3177,94 @@ TEST(CodeSerializerAfterExecute) {
   v8_flags.always_turbofan = prev_always_turbofan_value;
 }
 
+namespace {
+
+Tagged<SharedFunctionInfo> FindSharedFunctionInfo(
+    Isolate* isolate, DirectHandle<SharedFunctionInfo> toplevel,
+    const char* name) {
+  SharedFunctionInfo::ScriptIterator it(isolate,
+                                        Cast<Script>(toplevel->script()));
+  for (Tagged<SharedFunctionInfo> sfi = it.Next(); !sfi.is_null();
+       sfi = it.Next()) {
+    if (sfi->Name()->IsOneByteEqualTo(base::CStrVector(name))) return sfi;
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
+TEST(CodeSerializerKeepsTieringDecisions) {
+  v8_flags.profile_guided_optimization_in_code_cache = true;
+  FlagList::EnforceFlagImplications();
+  if (!v8_flags.profile_guided_optimization) return;
+
+  const char* js_source =
+      "function f() { return 'abc'; }; function g() {}; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source(v8_str(js_source),
+                                      v8::ScriptOrigin(v8_str("test")));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    // Pretend that f was optimized by Maglev and the compile is still being
+    // finalized.
+    DirectHandle<SharedFunctionInfo> toplevel =
+        v8::Utils::OpenDirectHandle(*script);
+    Tagged<SharedFunctionInfo> f =
+        FindSharedFunctionInfo(i_isolate1, toplevel, "f");
+    f->set_cached_tiering_decision(CachedTieringDecision::kEarlyMaglevPending);
+
+    cache = ScriptCompiler::CreateCodeCache(script);
+    CHECK(cache);
+    // Serialization must not change the decision in the producing isolate.
+    CHECK_EQ(CachedTieringDecision::kEarlyMaglevPending,
+             f->cached_tiering_decision());
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source(
+        v8_str(js_source), v8::ScriptOrigin(v8_str("test")), cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    DirectHandle<SharedFunctionInfo> toplevel =
+        v8::Utils::OpenDirectHandle(*script);
+    CHECK_EQ(CachedTieringDecision::kEarlyMaglev,
+             FindSharedFunctionInfo(i_isolate2, toplevel, "f")
+                 ->cached_tiering_decision());
+    CHECK_EQ(CachedTieringDecision::kPending,
+             FindSharedFunctionInfo(i_isolate2, toplevel, "g")
+                 ->cached_tiering_decision());
+  }
+  isolate2->Dispose();
+
+  v8_flags.profile_guided_optimization_in_code_cache = false;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
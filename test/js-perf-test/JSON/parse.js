@@ -0,0 +1,72 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Payloads of a few hundred KB modelled after typical API responses: arrays
+// of records with short keys, medium-sized string values and some numbers.
+
+new BenchmarkSuite('JSONParseMinified', [1000], [
+  new Benchmark('JSONParseMinified', false, false, 0, ParseJSON,
+                MinifiedSetup, TearDown)
+]);
+
+new BenchmarkSuite('JSONParsePretty', [1000], [
+  new Benchmark('JSONParsePretty', false, false, 0, ParseJSON,
+                PrettySetup, TearDown)
+]);
+
+new BenchmarkSuite('JSONParseLongStrings', [1000], [
+  new Benchmark('JSONParseLongStrings', false, false, 0, ParseJSON,
+                LongStringsSetup, TearDown)
+]);
+
+new BenchmarkSuite('JSONParseTwoByte', [1000], [
+  new Benchmark('JSONParseTwoByte', false, false, 0, ParseJSON,
+                TwoByteSetup, TearDown)
+]);
+
+let json;
+
+function MakeRecords(count, description) {
+  const records = [];
+  for (let i = 0; i < count; i++) {
+    records.push({
+      id: i,
+      name: 'user' + i,
+      email: 'user' + i + '@example.com',
+      active: i % 3 != 0,
+      score: i * 1.5,
+      tags: ['alpha', 'beta', 'gamma'],
+      description: description + i,
+    });
+  }
+  return records;
+}
+
+function MinifiedSetup() {
+  json = JSON.stringify(MakeRecords(2000, 'Lorem ipsum dolor sit amet '));
+}
+
+function PrettySetup() {
+  json = JSON.stringify(MakeRecords(2000, 'Lorem ipsum dolor sit amet '),
+                        null, 4);
+}
+
+function LongStringsSetup() {
+  const text = 'Lorem ipsum dolor sit amet, consectetur adipiscing elit. '
+      .repeat(20);
+  json = JSON.stringify(MakeRecords(500, text));
+}
+
+function TwoByteSetup() {
+  json = JSON.stringify(
+      MakeRecords(2000, 'Lorem ipsum dolor sit amet \u2014 \xe9t\xe9 '));
+}
+
+function ParseJSON() {
+  return JSON.parse(json);
+}
+
+function TearDown() {
+  json = undefined;
+}
@@ -0,0 +1,49 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Arrays of records that all share one hidden class, the common shape of
+// API responses built from database rows.
+
+new BenchmarkSuite('JSONStringifyRecords', [1000], [
+  new Benchmark('JSONStringifyRecords', false, false, 0, StringifyRecords,
+                RecordsSetup, StringifyTearDown)
+]);
+
+new BenchmarkSuite('JSONStringifyRecordsPretty', [1000], [
+  new Benchmark('JSONStringifyRecordsPretty', false, false, 0,
+                StringifyRecordsPretty, RecordsSetup, StringifyTearDown)
+]);
+
+let records;
+let stringified;
+
+function RecordsSetup() {
+  records = [];
+  for (let i = 0; i < 2000; i++) {
+    records.push({
+      id: i,
+      name: 'user' + i,
+      email: 'user' + i + '@example.com',
+      active: i % 3 != 0,
+      score: i * 1.5,
+      address: {street: 'Main St ' + i, city: 'Springfield', zip: '12345'},
+    });
+  }
+}
+
+function StringifyRecords() {
+  stringified = JSON.stringify(records);
+}
+
+function StringifyRecordsPretty() {
+  stringified = JSON.stringify(records, null, 2);
+}
+
+function StringifyTearDown() {
+  if (JSON.parse(stringified).length != records.length) {
+    throw new Error('Unexpected result');
+  }
+  records = undefined;
+  stringified = undefined;
+}
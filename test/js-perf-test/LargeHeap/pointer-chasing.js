@@ -0,0 +1,59 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Follows a chain of objects that is spread randomly over about 200MB of old
+// space, so that almost every step touches a different page. The score is
+// dominated by cache and TLB misses, which makes it useful for comparing runs
+// with and without --huge-pages-for-heap, e.g. under
+// `perf stat -e dTLB-load-misses`.
+
+new BenchmarkSuite('PointerChasing', [1000], [
+  new Benchmark('PointerChasing', false, false, 0, PointerChasing,
+                PointerChasingSetup, PointerChasingTearDown)
+]);
+
+const kNodeCount = 1 << 22;
+const kStepsPerRun = 1 << 20;
+
+let nodes;
+let current;
+
+function PointerChasingSetup() {
+  nodes = new Array(kNodeCount);
+  for (let i = 0; i < kNodeCount; i++) {
+    nodes[i] = {next: null, payload: i, padding: [i]};
+  }
+  // Link the nodes into one cycle in a random order, which defeats the
+  // prefetcher and keeps consecutive steps on distant pages.
+  const order = new Int32Array(kNodeCount);
+  for (let i = 0; i < kNodeCount; i++) order[i] = i;
+  let seed = 49734321;
+  for (let i = kNodeCount - 1; i > 0; i--) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    const j = seed % (i + 1);
+    const tmp = order[i];
+    order[i] = order[j];
+    order[j] = tmp;
+  }
+  for (let i = 0; i < kNodeCount; i++) {
+    nodes[order[i]].next = nodes[order[(i + 1) % kNodeCount]];
+  }
+  current = nodes[0];
+}
+
+function PointerChasing() {
+  let node = current;
+  let sum = 0;
+  for (let i = 0; i < kStepsPerRun; i++) {
+    sum += node.payload;
+    node = node.next;
+  }
+  current = node;
+  if (sum < 0) throw new Error('unexpected sum');
+}
+
+function PointerChasingTearDown() {
+  nodes = null;
+  current = null;
+}
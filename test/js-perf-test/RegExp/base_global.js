@@ -0,0 +1,60 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+d8.file.execute("base.js");
+
+var str;
+var re;
+
+function GlobalReplace() {
+  str.replace(re, "");
+}
+
+function GlobalReplaceAll() {
+  str.replaceAll(re, "xyz");
+}
+
+function GlobalMatch() {
+  str.match(re);
+}
+
+function GlobalMatchAll() {
+  for (const match of str.matchAll(re)) {}
+}
+
+function GlobalSplit() {
+  str.split(re);
+}
+
+// Long subjects with thousands of matches.
+function createLongHaystack() {
+  let s = createHaystack();
+  for (let i = 0; i < 9; i++) s += s;
+  return s;
+}
+
+function Global1Setup() {
+  re = /[Cz]/g;
+  str = createLongHaystack();
+}
+
+function Global2Setup() {
+  re = /([Cz])/g;
+  str = createLongHaystack();
+}
+
+function Global3Setup() {
+  re = /Cd/g;
+  str = createLongHaystack();
+}
+
+var benchmarks = [ [GlobalReplace, Global1Setup],
+                   [GlobalReplace, Global2Setup],
+                   [GlobalReplace, Global3Setup],
+                   [GlobalReplaceAll, Global1Setup],
+                   [GlobalMatch, Global1Setup],
+                   [GlobalMatch, Global3Setup],
+                   [GlobalMatchAll, Global2Setup],
+                   [GlobalSplit, Global1Setup],
+                 ];
@@ -0,0 +1,8 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+d8.file.execute("base.js");
+d8.file.execute("base_global.js");
+
+createBenchmarkSuite("Global");
@@ -8,6 +8,7 @@ d8.file.execute('../base.js');
 d8.file.execute('ctor.js');
 d8.file.execute('exec.js');
 d8.file.execute('flags.js');
+d8.file.execute('global.js');
 d8.file.execute('inline_test.js')
 d8.file.execute('complex_case_test.js');
 d8.file.execute('case_test.js');
@@ -0,0 +1,100 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches in multi-megabyte subjects, such as long log lines.
+
+new BenchmarkSuite('LargeSubjectIndexOf', [1000], [
+  new Benchmark('LargeSubjectIndexOf', true, false, 0,
+  LargeSubjectIndexOf),
+]);
+
+new BenchmarkSuite('LargeSubjectIndexOfLongPattern', [1000], [
+  new Benchmark('LargeSubjectIndexOfLongPattern', true, false, 0,
+  LargeSubjectIndexOfLongPattern),
+]);
+
+new BenchmarkSuite('LargeSubjectIncludes', [1000], [
+  new Benchmark('LargeSubjectIncludes', true, false, 0,
+  LargeSubjectIncludes),
+]);
+
+new BenchmarkSuite('LargeSubjectSplit', [1000], [
+  new Benchmark('LargeSubjectSplit', true, false, 0,
+  LargeSubjectSplit),
+]);
+
+new BenchmarkSuite('LargeTwoBytesSubjectIndexOf', [1000], [
+  new Benchmark('LargeTwoBytesSubjectIndexOf', true, false, 0,
+  LargeTwoBytesSubjectIndexOf),
+]);
+
+new BenchmarkSuite('LargeRopeIndexOf', [1000], [
+  new Benchmark('LargeRopeIndexOf', true, false, 0,
+  LargeRopeIndexOf),
+]);
+
+new BenchmarkSuite('LargeRopeIncludesEarly', [1000], [
+  new Benchmark('LargeRopeIncludesEarly', true, false, 0,
+  LargeRopeIncludesEarly),
+]);
+
+new BenchmarkSuite('LargeRopeMatchAll', [1000], [
+  new Benchmark('LargeRopeMatchAll', true, false, 0,
+  LargeRopeMatchAll),
+]);
+
+function MakeLogLine(entries, separator) {
+  const parts = [];
+  for (let i = 0; i < entries; i++) {
+    parts.push(`ts=${1700000000 + i} level=info msg="request served" ` +
+               `path=/api/v1/items/${i % 997} status=200`);
+  }
+  return parts.join(separator);
+}
+
+// About 4MB each; the needles only occur at the very end.
+const oneByteLine = MakeLogLine(50000, ' | ') + ' level=error msg="timeout"';
+const twoByteLine = MakeLogLine(50000, ' \u2502 ') + ' level=error msg="timeout"';
+
+function LargeSubjectIndexOf() {
+  return oneByteLine.indexOf('level=error');
+}
+
+function LargeSubjectIndexOfLongPattern() {
+  return oneByteLine.indexOf('level=error msg="timeout"');
+}
+
+function LargeSubjectIncludes() {
+  return oneByteLine.includes('status=500');
+}
+
+function LargeSubjectSplit() {
+  return oneByteLine.split(' | ').length;
+}
+
+function LargeTwoBytesSubjectIndexOf() {
+  return twoByteLine.indexOf('level=error');
+}
+
+// Renders a template by concatenation, which produces a rope of about 1MB.
+function RenderRope() {
+  let html = '<ul>';
+  for (let i = 0; i < 20000; i++) {
+    html += '<li class="item">' + i + ' <a href="/items/' + i + '">view</a>';
+  }
+  return html + '</ul>';
+}
+
+function LargeRopeIndexOf() {
+  return RenderRope().indexOf('</ul>');
+}
+
+function LargeRopeIncludesEarly() {
+  return RenderRope().includes('/items/10"');
+}
+
+// The rope is too left-deep to walk in place, and has 20000 matches.
+function LargeRopeMatchAll() {
+  return RenderRope().match(/view/g).length;
+}
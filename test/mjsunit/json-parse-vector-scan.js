@@ -0,0 +1,73 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.parse scans string bodies and whitespace a vector at a time. Place
+// terminators, escapes, control characters and two-byte characters at every
+// offset around the vector boundaries to exercise the scalar tails.
+
+(function TestStringTerminatorAtEveryOffset() {
+  for (let length = 0; length < 70; length++) {
+    const body = 'x'.repeat(length);
+    assertEquals(body, JSON.parse('"' + body + '"'));
+    assertEquals([body, 1], JSON.parse('["' + body + '",1]'));
+  }
+})();
+
+(function TestEscapeAtEveryOffset() {
+  for (let length = 0; length < 70; length++) {
+    const prefix = 'y'.repeat(length);
+    assertEquals(prefix + '"' + prefix, JSON.parse(
+        '"' + prefix + '\\"' + prefix + '"'));
+    assertEquals(prefix + '\\' + prefix, JSON.parse(
+        '"' + prefix + '\\\\' + prefix + '"'));
+    assertEquals(prefix + '\xe9' + prefix, JSON.parse(
+        '"' + prefix + '\\u00e9' + prefix + '"'));
+  }
+})();
+
+(function TestControlCharacterAtEveryOffset() {
+  for (let length = 0; length < 70; length++) {
+    const prefix = 'z'.repeat(length);
+    assertThrows(() => JSON.parse('"' + prefix + '\n' + prefix + '"'),
+                 SyntaxError);
+    assertThrows(() => JSON.parse('"' + prefix + '\x1f' + prefix + '"'),
+                 SyntaxError);
+    // DEL and Latin-1 characters are not control characters in JSON.
+    assertEquals(prefix + '\x7f\xff', JSON.parse('"' + prefix + '\x7f\xff"'));
+  }
+})();
+
+(function TestUnterminatedString() {
+  for (let length = 0; length < 70; length++) {
+    assertThrows(() => JSON.parse('"' + 'a'.repeat(length)), SyntaxError);
+  }
+})();
+
+(function TestTwoByteStrings() {
+  for (let length = 0; length < 70; length++) {
+    const latin1 = '\xe9'.repeat(length);
+    // The source is two-byte, but the value fits in one byte.
+    const source = '["\u20ac",' + JSON.stringify(latin1) + ']';
+    assertEquals(['\u20ac', latin1], JSON.parse(source));
+    for (let i = 0; i <= length; i++) {
+      const mixed = latin1.substring(0, i) + '\u20ac' + latin1.substring(i);
+      assertEquals(mixed, JSON.parse(JSON.stringify(mixed)));
+      assertEquals(mixed + '\n', JSON.parse('"' + mixed + '\\n"'));
+    }
+  }
+})();
+
+(function TestWhitespaceRuns() {
+  const whitespace = [' ', '\t', '\r', '\n'];
+  for (let length = 0; length < 70; length++) {
+    let run = '';
+    for (let i = 0; i < length; i++) run += whitespace[i % 4];
+    assertEquals({a: [1, 2]}, JSON.parse(
+        run + '{' + run + '"a"' + run + ':' + run + '[' + run + '1' + run +
+        ',' + run + '2' + run + ']' + run + '}' + run));
+    assertEquals('\u2028', JSON.parse(run + '"\u2028"' + run));
+    assertThrows(() => JSON.parse(run + '\v' + run + '1'), SyntaxError);
+    assertThrows(() => JSON.parse(run + '\xa0' + run + '1'), SyntaxError);
+  }
+})();
@@ -0,0 +1,108 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.stringify caches the property layout of maps it sees repeatedly. Check
+// that objects sharing a map serialize the same way as with the generic path.
+
+function Expected(records, gap) {
+  const parts = records.map(r => {
+    const keys = Object.keys(r);
+    if (keys.length == 0) return '{}';
+    const nl = gap ? '\n' + gap + gap : '';
+    const body = keys.filter(k => r[k] !== undefined)
+        .map(k => nl + JSON.stringify(k) + ':' + (gap ? ' ' : '') +
+                  JSON.stringify(r[k]))
+        .join(',');
+    return '{' + body + (gap ? '\n' + gap : '') + '}';
+  });
+  if (!gap) return '[' + parts.join(',') + ']';
+  return '[\n' + gap + parts.join(',\n' + gap) + '\n]';
+}
+
+(function TestSameShape() {
+  const records = [];
+  for (let i = 0; i < 50; i++) {
+    records.push({id: i, name: 'n' + i, score: i + 0.5, ok: i % 2 == 0});
+  }
+  assertEquals(Expected(records), JSON.stringify(records));
+  assertEquals(Expected(records, '  '), JSON.stringify(records, null, 2));
+})();
+
+(function TestUndefinedAndFunctionValues() {
+  const records = [];
+  for (let i = 0; i < 10; i++) {
+    records.push({a: i % 2 ? undefined : i, b: () => i, c: 'x'});
+  }
+  assertEquals(
+      '[' + records.map((r, i) => i % 2 ? '{"c":"x"}' : `{"a":${i},"c":"x"}`)
+                .join(',') + ']',
+      JSON.stringify(records));
+})();
+
+(function TestKeysNeedingEscapes() {
+  const records = [];
+  for (let i = 0; i < 10; i++) records.push({'a"b': i, 'c\nd': i});
+  assertEquals(Expected(records), JSON.stringify(records));
+})();
+
+(function TestTwoByteOutput() {
+  const records = [];
+  for (let i = 0; i < 10; i++) {
+    records.push({key: i == 5 ? '\u20ac' : 'x', other: i});
+  }
+  assertEquals(Expected(records), JSON.stringify(records));
+})();
+
+(function TestNonEnumerableProperties() {
+  const records = [];
+  for (let i = 0; i < 10; i++) {
+    const o = {a: i, b: i};
+    Object.defineProperty(o, 'hidden', {value: i, enumerable: false});
+    o.c = i;
+    records.push(o);
+  }
+  assertEquals(Expected(records), JSON.stringify(records));
+})();
+
+(function TestNestedSameShape() {
+  let list = null;
+  for (let i = 0; i < 30; i++) list = {value: i, next: list};
+  let expected = 'null';
+  for (let i = 0; i < 30; i++) expected = `{"value":${i},"next":${expected}}`;
+  assertEquals(expected, JSON.stringify(list));
+})();
+
+(function TestToJSONChangesShape() {
+  const records = [];
+  for (let i = 0; i < 10; i++) {
+    const o = {a: {toJSON() { o.b = 'changed'; return 1; }}, b: i, c: i};
+    records.push(o);
+  }
+  const result = JSON.parse(JSON.stringify(records));
+  for (let i = 0; i < 10; i++) {
+    assertEquals({a: 1, b: 'changed', c: i}, result[i]);
+  }
+})();
+
+(function TestToJSONDeletesProperty() {
+  const records = [];
+  for (let i = 0; i < 10; i++) {
+    const o = {a: {toJSON() { delete o.b; return 1; }}, b: i, c: i};
+    records.push(o);
+  }
+  const result = JSON.parse(JSON.stringify(records));
+  for (let i = 0; i < 10; i++) assertEquals({a: 1, c: i}, result[i]);
+})();
+
+(function TestManyShapes() {
+  // More maps than cache slots, interleaved.
+  const records = [];
+  for (let i = 0; i < 200; i++) {
+    const o = {};
+    o['k' + (i % 40)] = i;
+    o.common = 'v';
+    records.push(o);
+  }
+  assertEquals(Expected(records), JSON.stringify(records));
+})();
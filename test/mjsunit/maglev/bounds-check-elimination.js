@@ -0,0 +1,92 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-bounds-check-elimination
+// Flags: --no-always-turbofan
+
+function optimize(f, ...args) {
+  %PrepareFunctionForOptimization(f);
+  const expected = f(...args);
+  f(...args);
+  %OptimizeMaglevOnNextCall(f);
+  assertEquals(expected, f(...args));
+  return expected;
+}
+
+// The bounds check of a[i] is dominated by the loop condition.
+function sum(a) {
+  let s = 0;
+  for (let i = 0; i < a.length; i++) s += a[i];
+  return s;
+}
+assertEquals(10, optimize(sum, [1, 2, 3, 4]));
+assertEquals(0, sum([]));
+assertEquals(6, sum([1, 2, 3]));
+assertTrue(isMaglevved(sum));
+
+// Same with the comparison flipped.
+function sumFlipped(a) {
+  let s = 0;
+  for (let i = 1; a.length > i; i += 1) s += a[i];
+  return s;
+}
+assertEquals(9, optimize(sumFlipped, [1, 2, 3, 4]));
+assertEquals(0, sumFlipped([1]));
+
+// The array shrinks in the loop, so the length that is checked is not the one
+// of the loop condition and the check has to stay.
+function shrinking(input) {
+  const a = input.slice();
+  let s = 0;
+  for (let i = 0; i < a.length; i++) {
+    a.pop();
+    s += a[i] === undefined ? 100 : a[i];
+  }
+  return s;
+}
+assertEquals(101, optimize(shrinking, [1, 2, 3]));
+assertEquals(101, shrinking([1, 2, 3]));
+
+// A negative start keeps the check, and the access at -1 deoptimizes.
+function fromNegative(a, start) {
+  let s = 0;
+  for (let i = start; i < a.length; i++) s += a[i] | 0;
+  return s;
+}
+assertEquals(6, optimize(fromNegative, [1, 2, 3], 0));
+assertEquals(6, fromNegative([1, 2, 3], -1));
+
+// The loop runs one element too far, so the last access is out of bounds.
+function overrun(a) {
+  let s = 0;
+  for (let i = 0; i <= a.length; i++) s += a[i] === undefined ? 100 : a[i];
+  return s;
+}
+assertEquals(106, optimize(overrun, [1, 2, 3]));
+assertEquals(106, overrun([1, 2, 3]));
+
+// Counting down does not produce a non-negative induction variable.
+function countDown(a, n) {
+  let s = 0;
+  for (let i = n; i < a.length; i--) {
+    if (i < -2) break;
+    s += a[i] === undefined ? 100 : a[i];
+  }
+  return s;
+}
+assertEquals(206, optimize(countDown, [1, 2, 3], 2));
+assertEquals(206, countDown([1, 2, 3], 2));
+
+// The condition only holds on one path into the merge.
+function merged(a, c) {
+  let s = 0;
+  for (let i = 0; i < 4; i++) {
+    let ok = i < a.length;
+    if (c) ok = true;
+    if (ok) s += a[i] === undefined ? 100 : a[i];
+  }
+  return s;
+}
+assertEquals(3, optimize(merged, [1, 2], false));
+assertEquals(203, merged([1, 2], true));
@@ -0,0 +1,98 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --enable-experimental-regexp-engine --expose-gc
+// Flags: --experimental-regexp-engine-dfa
+
+// The experimental engine finds match ends with a lazily built DFA and only
+// runs the NFA on the matched range. Results have to agree with the
+// backtracking engine for all patterns both engines support.
+
+function Check(source, flags, subject) {
+  const linear = new RegExp(source, flags + 'l');
+  const backtracking = new RegExp(source, flags);
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(linear));
+  const description = `/${source}/${flags} on ${JSON.stringify(subject)}`;
+  if (flags.includes('g')) {
+    assertEquals(subject.match(backtracking), subject.match(linear),
+                 description);
+    assertEquals(subject.replace(backtracking, '<$&>'),
+                 subject.replace(linear, '<$&>'), description);
+  } else {
+    assertEquals(backtracking.exec(subject), linear.exec(subject),
+                 description);
+  }
+}
+
+const patterns = [
+  'a*b', 'a*?b', 'ab|a', 'a|ab', '(a|ab)(c|bcd)', '(a+)+b', '[ab]*c',
+  'a?a?a?aaa', '(ab|a)*', 'b*', '', 'a.c', '(a|b)*?c', 'c(a|b)+?',
+  'abc|bca|cab', '[bc]+a*', '(a|b|c)*c(a|b|c){2}', '(?<x>a)(?<y>b)?',
+  'a{2,4}', 'a{2,4}?b', '\\u1234+c',
+];
+
+const subjects = [
+  '', 'a', 'b', 'ab', 'baabb', 'aab', 'abcd', 'abcabcabc', 'cccbbbaaa',
+  'aaaaaaaaab', 'xyz', 'abababacbcbcbcd', 'aa\u1234ab\u1234\u1234c',
+  'a\nbc',
+];
+
+for (const source of patterns) {
+  for (const subject of subjects) {
+    Check(source, '', subject);
+    Check(source, 'g', subject);
+    Check(source, 's', subject);
+  }
+}
+
+// Matches far into long subjects, including two-byte ones.
+(() => {
+  const filler = 'abcabcabd'.repeat(1000);
+  for (const tail of ['aaab', 'abdabc', '\u1234xaab']) {
+    const subject = filler + tail;
+    for (const source of ['x?a+b', '(abd)+abc', 'ab[cd]ab', 'da{3}']) {
+      Check(source, '', subject);
+      Check(source, 'g', subject);
+    }
+  }
+})();
+
+// Sticky and lastIndex-driven searches start in the middle of the subject.
+(() => {
+  const re = /a+b/gl;
+  const subject = 'xaab aaab ab b';
+  const ends = [];
+  let match;
+  while ((match = re.exec(subject)) !== null) ends.push(re.lastIndex);
+  assertEquals([4, 9, 12], ends);
+  const sticky = /a+b/yl;
+  sticky.lastIndex = 5;
+  assertEquals('aaab', sticky.exec(subject)[0]);
+  sticky.lastIndex = 4;
+  assertEquals(null, sticky.exec(subject));
+})();
+
+// Patterns with assertions or lookbehinds keep using the interpreter alone.
+(() => {
+  Check('^a+b', '', 'aab');
+  Check('a+b$', '', 'aab aaab');
+  Check('\\bab', 'g', 'ab cab ab');
+  Check('(?<=a)b', '', 'bab');
+})();
+
+// The DFA is kept with the regexp, so later executions reuse the states of
+// earlier ones, including across one-byte and two-byte subjects and GCs.
+(() => {
+  for (const source of patterns) {
+    const linear = new RegExp(source, 'gl');
+    const backtracking = new RegExp(source, 'g');
+    for (let i = 0; i < 2; i++) {
+      for (const subject of subjects) {
+        assertEquals(subject.match(backtracking), subject.match(linear),
+                     `/${source}/ on ${JSON.stringify(subject)}`);
+      }
+      gc();
+    }
+  }
+})();
@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Global matches on long subjects are fetched from the regexp code in large
+// batches. Check results with more matches than fit into one batch, with
+// captures, empty matches and atoms.
+
+function naiveMatches(re, subject) {
+  const sticky = new RegExp(re.source, re.flags.replace('g', '') + 'y');
+  const result = [];
+  for (let i = 0; i <= subject.length; i++) {
+    sticky.lastIndex = i;
+    const match = sticky.exec(subject);
+    if (match === null) continue;
+    result.push(match);
+    if (match[0].length > 0) i = sticky.lastIndex - 1;
+  }
+  return result;
+}
+
+function check(re, subject) {
+  const expected = naiveMatches(re, subject);
+  assertEquals(expected.map(m => m[0]), subject.match(re) ?? []);
+  assertEquals(expected.map(m => m.index),
+               [...subject.matchAll(re)].map(m => m.index));
+  let i = 0;
+  subject.replace(re, (...args) => {
+    const match = expected[i++];
+    assertEquals(match.index, args[match.length]);
+    for (let j = 0; j < match.length; j++) assertEquals(match[j], args[j]);
+    return '';
+  });
+  assertEquals(expected.length, i);
+  assertEquals(subject.replace(re, '[$&]').length,
+               subject.length + 2 * expected.length);
+}
+
+// Long enough for the large batches, with thousands of matches.
+const haystack = 'abCdefgz'.repeat(5000);
+
+(() => {
+  check(/[Cz]/g, haystack);
+  check(/([Cz])(d)?/g, haystack);
+  check(/Cd/g, haystack);
+  check(/(?:)/g, haystack.substring(0, 20000));
+  check(/z*/g, haystack.substring(0, 20000));
+  check(/[Cz]/g, haystack + '\u1234');
+  check(/\u{1F600}|a/gu, '\u{1F600}a'.repeat(6000));
+  check(/C/g, 'xC'.repeat(10000));
+})();
+
+// Short subjects keep working with the small batches.
+(() => {
+  check(/[Cz]/g, 'abCdefgz');
+  check(/Cd/g, 'abCdefgzCd');
+  check(/z*/g, 'zzazz');
+})();
@@ -0,0 +1,106 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Large disjunctions of literals are factored on common prefixes and dispatch
+// on the first character. Matches have to keep the leftmost, first-listed
+// alternative semantics.
+
+function naiveExec(words, subject, from, sticky) {
+  const last = sticky ? from : subject.length;
+  for (let i = from; i <= last; i++) {
+    for (const word of words) {
+      if (subject.startsWith(word, i)) return {index: i, word};
+    }
+  }
+  return null;
+}
+
+function escape(word) {
+  return word.replace(/[\\^$.*+?()[\]{}|]/g, '\\$&');
+}
+
+function check(words, subject, flags = '') {
+  const re = new RegExp(words.map(escape).join('|'), 'g' + flags);
+  let from = 0;
+  while (true) {
+    const expected = naiveExec(words, subject, from, flags.includes('y'));
+    const match = re.exec(subject);
+    if (expected === null) {
+      assertNull(match, `${words} on ${subject}`);
+      return;
+    }
+    assertEquals(expected.index, match.index, `${words} on ${subject}`);
+    assertEquals(expected.word, match[0], `${words} on ${subject}`);
+    from = match.index + Math.max(match[0].length, 1);
+    re.lastIndex = from;
+  }
+}
+
+const keywords = [
+  'break', 'case', 'catch', 'class', 'const', 'continue', 'debugger',
+  'default', 'delete', 'do', 'else', 'export', 'extends', 'finally', 'for',
+  'function', 'if', 'import', 'in', 'instanceof', 'new', 'return', 'super',
+  'switch', 'this', 'throw', 'try', 'typeof', 'var', 'void', 'while', 'with',
+  'yield',
+];
+
+const text = 'for (const x in y) { if (x instanceof Foo) return new x(); ' +
+             'else do { yield this; } while (typeof x === "void") } ' +
+             'exporting classes, deleted defaults, trying to finally_ ';
+
+(() => {
+  check(keywords, text);
+  check(keywords, text.repeat(20));
+  check(keywords, text, 'y');
+  check(keywords.slice().reverse(), text);
+  check(keywords, '\u1234' + text + '\u20ac');
+})();
+
+// Case-insensitive and unicode disjunctions keep trying alternatives in
+// order.
+(() => {
+  const source = keywords.join('|');
+  const expected = text.match(new RegExp(source, 'g'));
+  assertEquals(expected.map(word => word.toUpperCase()),
+               text.toUpperCase().match(new RegExp(source, 'gi')));
+  assertEquals(expected, text.match(new RegExp(source, 'gu')));
+})();
+
+// Alternatives that are prefixes of each other keep their order.
+(() => {
+  const words = ['foo', 'foobar', 'fo', 'bar', 'barbaz', 'ba', 'qux', 'q',
+                 'x', 'xy', 'yz', 'y'];
+  const subject = 'foobarbazquxxyz fobaqq f b';
+  check(words, subject);
+  check(words.slice().reverse(), subject);
+  check(words.slice().sort(), subject);
+})();
+
+// Pairs of alternatives with a common first character.
+(() => {
+  const words = ['ab', 'ac', 'bd', 'be', 'cf', 'cg', 'dh', 'di', 'ej', 'ek'];
+  check(words, 'abacbdbecfcgdhdiejekaabbccddee');
+  check(words, 'xaxbxcxdxe');
+})();
+
+// Character classes as alternatives, with and without overlapping first
+// characters.
+(() => {
+  const disjoint = /[a-c]x|[d-f]y|[g-i]z|[j-l]x|[m-o]y|[p-r]z|[s-u]x|[^a-z]y/g;
+  assertEquals(['ax', 'ey', 'iz', 'lx', 'my', 'qz', 'ux', '1y', 'bx'],
+               'axeyizlxmyqzux1ybx'.match(disjoint));
+  assertEquals(null, 'aybzcy'.match(disjoint));
+  const overlapping = /[a-c]x|[b-f]y|[c-i]z|[a-l]w|m|n|o|p/g;
+  assertEquals(['by', 'cz', 'aw', 'm', 'p'],
+               'ay by cz aw m p'.match(overlapping));
+})();
+
+// Unicode alternatives and one-byte subjects that can't match them.
+(() => {
+  const words = ['\u1234a', '\u1235b', '\u20acc', 'dd', 'ee', 'ff', 'gg',
+                 'hh', '\u00e9i'];
+  check(words, 'xx\u1234a\u20acc dd \u00e9i \u1235c');
+  check(words, 'dd ee ff gg hh ii');
+  check(words, '\u00e9i', 'u');
+})();
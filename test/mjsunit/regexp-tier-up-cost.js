@@ -0,0 +1,68 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Interpreted executions are charged by their work, so cheap regexps stay in
+// the interpreter for the number of tier-up ticks while expensive ones tier
+// up right away.
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=4
+// Flags: --regexp-tier-up-work-per-tick=100
+// Flags: --allow-natives-syntax --no-force-slow-path --no-regexp-interpret-all
+// Flags: --no-enable-experimental-regexp-engine
+//
+// Concurrent compiles can trigger interrupts which would cause regexp
+// re-execution and thus mess with test expectations below.
+// Flags: --no-concurrent-recompilation
+
+const kLatin1 = true;
+
+function AssertInterpreted(regexp) {
+  assertTrue(%RegexpHasBytecode(regexp, kLatin1));
+  assertFalse(%RegexpHasNativeCode(regexp, kLatin1));
+}
+
+function AssertCompiled(regexp) {
+  assertFalse(%RegexpHasBytecode(regexp, kLatin1));
+  assertTrue(%RegexpHasNativeCode(regexp, kLatin1));
+}
+
+// Cheap executions cost one tick each.
+(() => {
+  const re = /^a[bc]/;
+  for (let i = 0; i < 4; i++) {
+    assertTrue(re.test('abc'));
+    AssertInterpreted(re);
+  }
+  assertTrue(re.test('abc'));
+  AssertCompiled(re);
+})();
+
+// Matches only pay for the part of the subject up to the match end.
+(() => {
+  const re = /^b[cd]/;
+  const subject = 'bc' + 'x'.repeat(900);
+  for (let i = 0; i < 4; i++) {
+    assertTrue(re.test(subject));
+    AssertInterpreted(re);
+  }
+  assertTrue(re.test(subject));
+  AssertCompiled(re);
+})();
+
+// A failed search through a long subject uses up the ticks at once.
+(() => {
+  const re = /[xy]z/;
+  assertFalse(re.test('a'.repeat(900)));
+  AssertInterpreted(re);
+  assertFalse(re.test('a'));
+  AssertCompiled(re);
+})();
+
+// So does heavy backtracking on a short subject.
+(() => {
+  const re = /(c+)+d/;
+  assertFalse(re.test('c'.repeat(12)));
+  AssertInterpreted(re);
+  assertFalse(re.test('c'));
+  AssertCompiled(re);
+})();
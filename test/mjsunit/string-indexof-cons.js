@@ -0,0 +1,84 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Long cons strings are searched segment by segment instead of being
+// flattened. Check matches inside segments, across segment boundaries and
+// across several segments shorter than the pattern.
+
+function naiveIndexOf(subject, pattern, from) {
+  for (let i = from; i + pattern.length <= subject.length; i++) {
+    if (subject.substring(i, i + pattern.length) === pattern) return i;
+  }
+  return -1;
+}
+
+// Builds a fresh rope from {pieces} so that no search sees a string that an
+// earlier search flattened.
+function rope(pieces) {
+  let result = '';
+  for (const piece of pieces) result += piece;
+  return result;
+}
+
+const filler = 'abcdefghij'.repeat(120);
+const pieces = [filler, 'x', 'y', 'zz', filler, 'needle', filler, 'nee',
+                'dle', filler, 'n', 'e', 'e', 'd', 'l', 'e', filler];
+
+(() => {
+  const flat = pieces.join('');
+  const patterns = ['needle', 'xyzz', 'jx', 'zza', 'ee', 'jn', 'eabc',
+                    'hijabcdefghijabc', 'missing', 'e'];
+  for (const pattern of patterns) {
+    for (const from of [0, 1, 1199, 1200, 1201, 1204, 2410, 3700]) {
+      assertEquals(naiveIndexOf(flat, pattern, from),
+                   rope(pieces).indexOf(pattern, from),
+                   `${pattern} from ${from}`);
+    }
+    assertEquals(flat.includes(pattern), rope(pieces).includes(pattern));
+  }
+})();
+
+// Two-byte segments and patterns.
+(() => {
+  const two_byte_pieces = [filler, '\u1234x', 'y', filler, '\u20ac', 'z'];
+  const flat = two_byte_pieces.join('');
+  for (const pattern of ['\u1234xy', 'xyabc', 'j\u20acz', 'x', 'j\u1234',
+                         '\u20ac\u20ac']) {
+    assertEquals(naiveIndexOf(flat, pattern, 0),
+                 rope(two_byte_pieces).indexOf(pattern), pattern);
+  }
+})();
+
+// Atom regexps use the same search.
+(() => {
+  assertEquals(naiveIndexOf(pieces.join(''), 'needle', 0),
+               rope(pieces).search(/needle/));
+  const match = /xyzz/.exec(rope(pieces));
+  assertEquals(1200, match.index);
+  assertEquals(['needle', 'needle', 'needle'],
+               rope(pieces).match(/needle/g));
+  assertEquals(3, rope(pieces).split('needle').length - 1);
+})();
+
+// Ropes built by appending in a loop are too left-deep to walk in place, and
+// are flattened instead. Global atom regexps on shallow ropes collect their
+// matches in one pass. Both have to find every match.
+(() => {
+  let deep = '';
+  for (let i = 0; i < 5000; i++) deep += 'ab' + (i % 10) + 'x';
+  assertEquals(4999, deep.match(/xa/g).length);
+  assertEquals(500, deep.match(/b7x/g).length);
+
+  let deep_for_index_of = '';
+  for (let i = 0; i < 5000; i++) deep_for_index_of += 'ab' + (i % 10) + 'x';
+  assertEquals(37, deep_for_index_of.indexOf('b9xab0'));
+
+  // String.prototype.repeat builds a balanced rope, which is searched in place.
+  const shallow = () => 'aab'.repeat(3000) + 'aa';
+  assertEquals(3001, shallow().match(/aa/g).length);
+  assertEquals(3000, shallow().split('ab').length - 1);
+  assertEquals('aa', shallow().replace(/aab/g, ''));
+  assertEquals(naiveIndexOf(shallow(), 'baa', 4000),
+               shallow().indexOf('baa', 4000));
+})();
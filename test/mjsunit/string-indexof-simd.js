@@ -0,0 +1,73 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Checks substring search on subjects long enough to be scanned a vector at
+// a time, with matches and near-matches around vector boundaries.
+
+function naiveIndexOf(subject, pattern, from) {
+  for (let i = from; i + pattern.length <= subject.length; i++) {
+    if (subject.substring(i, i + pattern.length) === pattern) return i;
+  }
+  return -1;
+}
+
+function check(subject, pattern) {
+  for (let from = 0; from <= subject.length; from += 5) {
+    assertEquals(naiveIndexOf(subject, pattern, from),
+                 subject.indexOf(pattern, from),
+                 `${JSON.stringify(pattern)} from ${from}`);
+  }
+}
+
+const patterns = ['ab', 'ba', 'aab', 'abca', 'aaaaab', 'abcabca', 'a\u1234b',
+                  'cab\u1234', 'abcdefghijklmnopqrstuvwxyz', 'zz'];
+
+// One-byte subjects with the first and last pattern characters everywhere,
+// so that most candidates only fail in the middle.
+(() => {
+  let subject = '';
+  for (let i = 0; i < 200; i++) subject += 'aabc'[(i * 7) % 4];
+  subject += 'aaaaabcabcadefghijklmnopqrstuvwxyz';
+  for (const pattern of patterns) check(subject, pattern);
+})();
+
+// Two-byte subjects.
+(() => {
+  let subject = '';
+  for (let i = 0; i < 200; i++) subject += 'ab\u1234c'[(i * 5) % 4];
+  subject += 'cab\u1234';
+  for (const pattern of patterns) check(subject, pattern);
+})();
+
+// A match at every offset of the last vector, ending at the end of the
+// subject.
+(() => {
+  for (let length = 2; length < 80; length++) {
+    const subject = 'x'.repeat(length) + 'yz';
+    assertEquals(length, subject.indexOf('yz'));
+    assertEquals(length - 1, subject.indexOf('xyz'));
+    assertEquals(-1, subject.indexOf('zy'));
+    const two_byte = '\u1234'.repeat(length) + 'yz';
+    assertEquals(length, two_byte.indexOf('yz'));
+    assertEquals(length - 1, two_byte.indexOf('\u1234yz'));
+  }
+})();
+
+// Characters that only match in their low byte.
+(() => {
+  const subject = '\u0161'.repeat(100) + 'ab' + '\u0162\u0163';
+  assertEquals(-1, subject.indexOf('ac'));
+  assertEquals(100, subject.indexOf('ab'));
+  assertEquals(-1, subject.indexOf('a\u0163'));
+  assertEquals(101, subject.indexOf('b\u0162\u0163'));
+  assertTrue(subject.includes('\u0161\u0161a'));
+})();
+
+// split and includes share the same search.
+(() => {
+  const line = ('key=value; ').repeat(500) + 'end';
+  assertEquals(501, line.split('; ').length);
+  assertTrue(line.includes('value; end'));
+  assertFalse(line.includes('value;end'));
+})();
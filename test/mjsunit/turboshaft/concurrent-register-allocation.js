@@ -0,0 +1,50 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turboshaft
+// Flags: --turboshaft-concurrent-register-allocation
+// Flags: --turboshaft-concurrent-register-allocation-min-instructions=0
+
+// Keeps more integer and floating point values alive than there are
+// registers, across calls and loops, so that both allocators split and spill.
+function opaque(x) { return x; }
+%NeverOptimizeFunction(opaque);
+
+function mixed(n, d) {
+  let i0 = n | 0, i1 = (n + 1) | 0, i2 = (n + 2) | 0, i3 = (n + 3) | 0;
+  let i4 = (n + 4) | 0, i5 = (n + 5) | 0, i6 = (n + 6) | 0, i7 = (n + 7) | 0;
+  let f0 = d, f1 = d * 2, f2 = d * 3, f3 = d * 4;
+  let f4 = d * 5, f5 = d * 6, f6 = d * 7, f7 = d * 8;
+  for (let k = 0; k < n; k++) {
+    i0 = (i0 + i7) | 0; i1 = (i1 ^ i6) | 0; i2 = (i2 + i5) | 0;
+    i3 = (i3 - i4) | 0; i4 = (i4 + k) | 0; i5 = (i5 * 3) | 0;
+    f0 += f7; f1 -= f6 * 0.5; f2 *= 1.0001; f3 += f4 / 3;
+    f4 = Math.sqrt(f4 * f4 + 1); f5 += f0; f6 -= f1; f7 += 0.25;
+    opaque(k);
+    if (k == 7) {
+      i6 = (i6 + opaque(i0)) | 0;
+      f6 += opaque(f0);
+    }
+  }
+  return [i0 + i1 + i2 + i3 + i4 + i5 + i6 + i7,
+          f0 + f1 + f2 + f3 + f4 + f5 + f6 + f7];
+}
+
+%PrepareFunctionForOptimization(mixed);
+const expected = [mixed(10, 1.5), mixed(20, -0.25), mixed(0, 3)];
+%OptimizeFunctionOnNextCall(mixed);
+assertEquals(expected, [mixed(10, 1.5), mixed(20, -0.25), mixed(0, 3)]);
+assertOptimized(mixed);
+
+// Functions without floating point values only use the general allocator.
+function ints(a, b) {
+  let s = 0;
+  for (let k = 0; k < a; k++) s = (s + (k ^ b)) | 0;
+  return s;
+}
+
+%PrepareFunctionForOptimization(ints);
+assertEquals(45, ints(10, 0));
+%OptimizeFunctionOnNextCall(ints);
+assertEquals(45, ints(10, 0));
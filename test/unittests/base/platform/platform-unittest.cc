@@ -76,6 +76,32 @@ TEST(OS, RemapPages) {
   }
 }
 
+TEST(OS, AdviseHugePages) {
+  constexpr size_t kTransparentHugePageSize = 2 * 1024 * 1024;
+  const size_t size = 2 * kTransparentHugePageSize;
+  void* memory = OS::Allocate(nullptr, size, kTransparentHugePageSize,
+                              OS::MemoryPermission::kNoAccess);
+  ASSERT_TRUE(memory);
+
+  // Ranges that don't contain an aligned huge page are left alone.
+  EXPECT_FALSE(OS::AdviseHugePages(memory, kTransparentHugePageSize - 1));
+
+  // Whether the advice is taken depends on the OS and its configuration, but
+  // the memory has to stay usable either way.
+  bool advised = OS::AdviseHugePages(memory, size);
+#if !V8_OS_LINUX
+  EXPECT_FALSE(advised);
+#else
+  USE(advised);
+#endif
+  ASSERT_TRUE(
+      OS::SetPermissions(memory, size, OS::MemoryPermission::kReadWrite));
+  static_cast<char*>(memory)[0] = 1;
+  static_cast<char*>(memory)[size - 1] = 1;
+  EXPECT_EQ(1, static_cast<char*>(memory)[size - 1]);
+  OS::Free(memory, size);
+}
+
 #ifdef V8_TARGET_OS_LINUX
 TEST(OS, ParseProcMaps) {
   // Truncated
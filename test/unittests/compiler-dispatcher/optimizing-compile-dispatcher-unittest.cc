@@ -15,6 +15,7 @@
 #include "src/heap/local-heap.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -22,19 +23,21 @@
 namespace v8 {
 namespace internal {
 
-using OptimizingCompileDispatcherTest = TestWithNativeContext;
+using OptimizingCompileDispatcherTest = TestWithNativeContextAndCounters;
 
 namespace {
 
 class BlockingCompilationJob : public TurbofanCompilationJob {
  public:
-  BlockingCompilationJob(Isolate* isolate, Handle<JSFunction> function)
+  BlockingCompilationJob(Isolate* isolate, Handle<JSFunction> function,
+                         bool* finalized = nullptr)
       : TurbofanCompilationJob(&info_, State::kReadyToExecute),
         shared_(function->shared(), isolate),
         zone_(isolate->allocator(), ZONE_NAME),
         info_(&zone_, isolate, shared_, function, CodeKind::TURBOFAN),
         blocking_(false),
-        semaphore_(0) {}
+        semaphore_(0),
+        finalized_(finalized) {}
   ~BlockingCompilationJob() override = default;
   BlockingCompilationJob(const BlockingCompilationJob&) = delete;
   BlockingCompilationJob& operator=(const BlockingCompilationJob&) = delete;
@@ -53,7 +56,10 @@ class BlockingCompilationJob : public TurbofanCompilationJob {
     return SUCCEEDED;
   }
 
-  Status FinalizeJobImpl(Isolate* isolate) override { return SUCCEEDED; }
+  Status FinalizeJobImpl(Isolate* isolate) override {
+    if (finalized_) *finalized_ = true;
+    return SUCCEEDED;
+  }
 
  private:
   Handle<SharedFunctionInfo> shared_;
@@ -61,6 +67,7 @@ class BlockingCompilationJob : public TurbofanCompilationJob {
   OptimizedCompilationInfo info_;
   base::AtomicValue<bool> blocking_;
   base::Semaphore semaphore_;
+  bool* const finalized_;
 };
 
 }  // namespace
@@ -96,5 +103,134 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, QueueOrdersByTicks) {
+  Handle<JSFunction> functions[3];
+  std::unique_ptr<BlockingCompilationJob> jobs[3];
+  OptimizingCompileDispatcherQueue queue(3);
+  for (int i = 0; i < 3; ++i) {
+    functions[i] = RunJS<JSFunction>("(function f() {})");
+    IsCompiledScope is_compiled_scope;
+    ASSERT_TRUE(Compiler::Compile(i_isolate(), functions[i],
+                                  Compiler::CLEAR_EXCEPTION,
+                                  &is_compiled_scope));
+    jobs[i] = std::make_unique<BlockingCompilationJob>(i_isolate(),
+                                                       functions[i]);
+    queue.Enqueue(jobs[i].get());
+    ASSERT_TRUE(queue.Contains(*functions[i]));
+  }
+  ASSERT_FALSE(queue.IsAvailable());
+
+  // Jobs with more ticks come first, and ties are broken in FIFO order.
+  queue.Prioritize(functions[2]->shared());
+  queue.Prioritize(functions[2]->shared());
+  queue.Prioritize(functions[1]->shared());
+  queue.Prioritize(functions[0]->shared());
+  base::TimeDelta wait_time;
+  ASSERT_EQ(jobs[2].get(), queue.Dequeue(&wait_time));
+  ASSERT_LE(base::TimeDelta(), wait_time);
+  ASSERT_FALSE(queue.Contains(*functions[2]));
+  ASSERT_EQ(jobs[0].get(), queue.Dequeue());
+  ASSERT_EQ(jobs[1].get(), queue.Dequeue());
+  ASSERT_EQ(nullptr, queue.Dequeue());
+  ASSERT_EQ(0, queue.Length());
+}
+
+TEST_F(OptimizingCompileDispatcherTest, DiscardStartedJob) {
+  Handle<JSFunction> fun = RunJS<JSFunction>("(function f() {})");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), fun, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  JSFunction::EnsureFeedbackVector(i_isolate(), fun, &is_compiled_scope);
+  bool finalized = false;
+  BlockingCompilationJob* job =
+      new BlockingCompilationJob(i_isolate(), fun, &finalized);
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  dispatcher.QueueForOptimization(job);
+
+  // Busy-wait for the job to run on a background thread.
+  while (!job->IsBlocking()) {
+  }
+
+  // The function deoptimizes while the job runs, and a new request for it is
+  // made before the job finishes.
+  dispatcher.DiscardStartedJobs(*fun);
+  fun->set_tiering_state(i_isolate(), TieringState::kInProgress);
+  int discarded =
+      i_isolate()->counters()->turbofan_optimize_jobs_discarded()->Get();
+
+  job->Signal();
+  dispatcher.AwaitCompileTasks();
+  dispatcher.InstallOptimizedFunctions();
+
+  // The result is dropped without touching the tiering state of the newer
+  // request.
+  ASSERT_FALSE(finalized);
+  ASSERT_EQ(TieringState::kInProgress, fun->tiering_state());
+  ASSERT_FALSE(fun->HasAttachedCodeKind(i_isolate(), CodeKind::TURBOFAN));
+  ASSERT_EQ(discarded + 1,
+            i_isolate()->counters()->turbofan_optimize_jobs_discarded()->Get());
+  ASSERT_FALSE(dispatcher.HasJobs());
+  dispatcher.Stop();
+}
+
+TEST_F(OptimizingCompileDispatcherTest, MergeRequestIntoQueuedJob) {
+  if (!v8_flags.turbofan || v8_flags.always_turbofan ||
+      !i_isolate()->concurrent_recompilation_enabled()) {
+    GTEST_SKIP();
+  }
+  // A single background thread, so that a blocking job keeps the next one
+  // in the input queue.
+  FLAG_VALUE_SCOPE(concurrent_turbofan_max_threads, 1);
+  FLAG_SCOPE(allow_natives_syntax);
+  OptimizingCompileDispatcher* dispatcher =
+      i_isolate()->optimizing_compile_dispatcher();
+
+  Handle<JSFunction> blocker = RunJS<JSFunction>("(function blocker() {})");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), blocker,
+                                Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  Handle<JSFunction> fun = RunJS<JSFunction>(
+      "function f(x) { return x + 1; }"
+      "%PrepareFunctionForOptimization(f);"
+      "f(1); f(2); f");
+
+  BlockingCompilationJob* job =
+      new BlockingCompilationJob(i_isolate(), blocker);
+  dispatcher->QueueForOptimization(job);
+  while (!job->IsBlocking()) {
+  }
+
+  Compiler::CompileOptimized(i_isolate(), fun, ConcurrencyMode::kConcurrent,
+                             CodeKind::TURBOFAN);
+  ASSERT_TRUE(dispatcher->HasQueuedJob(*fun));
+  ASSERT_TRUE(IsInProgress(fun->tiering_state()));
+
+  // A deopt withdraws the request before its job started. The job is kept,
+  // and the next request is merged into it.
+  fun->reset_tiering_state();
+  dispatcher->DiscardStartedJobs(*fun);
+  ASSERT_TRUE(dispatcher->HasQueuedJob(*fun));
+  Compiler::CompileOptimized(i_isolate(), fun, ConcurrencyMode::kConcurrent,
+                             CodeKind::TURBOFAN);
+  ASSERT_TRUE(IsInProgress(fun->tiering_state()));
+
+  // Drop the blocking job, which has no code to install.
+  dispatcher->DiscardStartedJobs(*blocker);
+  int discarded =
+      i_isolate()->counters()->turbofan_optimize_jobs_discarded()->Get();
+  job->Signal();
+  dispatcher->AwaitCompileTasks();
+  dispatcher->InstallOptimizedFunctions();
+
+  // A second job for f would have been discarded because f was already
+  // optimized by the first one.
+  ASSERT_EQ(discarded + 1,
+            i_isolate()->counters()->turbofan_optimize_jobs_discarded()->Get());
+  ASSERT_TRUE(fun->HasAttachedCodeKind(i_isolate(), CodeKind::TURBOFAN));
+  ASSERT_TRUE(IsNone(fun->tiering_state()));
+}
+
 }  // namespace internal
 }  // namespace v8
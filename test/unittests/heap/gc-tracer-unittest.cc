@@ -7,6 +7,7 @@
 #include <cmath>
 #include <limits>
 
+#include "include/v8-isolate.h"
 #include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
@@ -401,6 +402,50 @@ TEST_F(GCTracerTest, MutatorUtilization) {
                    tracer->AverageMarkCompactMutatorUtilization());
 }
 
+TEST_F(GCTracerTest, GCProfileStatistics) {
+  if (v8_flags.stress_incremental_marking) return;
+  Heap* heap = i_isolate()->heap();
+  GCTracer* tracer = heap->tracer();
+  heap->SetGarbageCollectionProfile(GarbageCollectionProfile::kDefault);
+  tracer->ResetForTesting();
+
+  heap->SetGarbageCollectionProfile(GarbageCollectionProfile::kLowLatency);
+  StartTracing(tracer, GarbageCollector::SCAVENGER, StartTracingMode::kAtomic,
+               base::TimeTicks::FromMsTicksForTesting(100));
+  StopTracing(tracer, GarbageCollector::SCAVENGER,
+              base::TimeTicks::FromMsTicksForTesting(110));
+  StartTracing(tracer, GarbageCollector::MARK_COMPACTOR,
+               StartTracingMode::kAtomic,
+               base::TimeTicks::FromMsTicksForTesting(200));
+  StopTracing(tracer, GarbageCollector::MARK_COMPACTOR,
+              base::TimeTicks::FromMsTicksForTesting(230));
+  heap->SetGarbageCollectionProfile(GarbageCollectionProfile::kDefault);
+
+  const GCTracer::GCProfileStatistics low_latency =
+      tracer->GetGCProfileStatistics(GarbageCollectionProfile::kLowLatency);
+  EXPECT_EQ(1u, low_latency.young_gcs);
+  EXPECT_EQ(1u, low_latency.full_gcs);
+  EXPECT_EQ(base::TimeDelta::FromMilliseconds(40), low_latency.total_pause);
+  EXPECT_EQ(base::TimeDelta::FromMilliseconds(30), low_latency.max_pause);
+  EXPECT_LE(base::TimeDelta(), low_latency.active_time);
+
+  const GCTracer::GCProfileStatistics throughput =
+      tracer->GetGCProfileStatistics(GarbageCollectionProfile::kThroughput);
+  EXPECT_EQ(0u, throughput.young_gcs);
+  EXPECT_EQ(0u, throughput.full_gcs);
+  EXPECT_TRUE(throughput.active_time.IsZero());
+
+  // Embedders see the same statistics.
+  GarbageCollectionProfileStatistics api_statistics;
+  ASSERT_TRUE(isolate()->GetGarbageCollectionProfileStatistics(
+      GarbageCollectionProfile::kLowLatency, &api_statistics));
+  EXPECT_EQ(1u, api_statistics.young_gc_count());
+  EXPECT_EQ(1u, api_statistics.full_gc_count());
+  EXPECT_DOUBLE_EQ(40.0, api_statistics.total_pause_ms());
+  EXPECT_DOUBLE_EQ(30.0, api_statistics.max_pause_ms());
+  EXPECT_LE(0.0, api_statistics.active_time_ms());
+}
+
 TEST_F(GCTracerTest, BackgroundScavengerScope) {
   if (v8_flags.stress_incremental_marking) return;
   GCTracer* tracer = i_isolate()->heap()->tracer();
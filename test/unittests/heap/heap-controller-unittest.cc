@@ -63,6 +63,24 @@ TEST_F(MemoryControllerTest, MaxHeapGrowingFactor) {
                              static_cast<size_t>(V8HeapTrait::kMaxSize)));
 }
 
+TEST_F(MemoryControllerTest, ThroughputHeapGrowingFactor) {
+  const double mu = V8HeapTrait::kThroughputTargetMutatorUtilization;
+  CheckEqualRounded(V8HeapTrait::kMaxGrowingFactor,
+                    V8Controller::DynamicGrowingFactor(100, 1, 4.0, mu));
+  CheckEqualRounded(1.493, V8Controller::DynamicGrowingFactor(300, 1, 4.0, mu));
+  CheckEqualRounded(V8HeapTrait::kMinGrowingFactor,
+                    V8Controller::DynamicGrowingFactor(2000, 1, 4.0, mu));
+
+  Heap* heap = i_isolate()->heap();
+  const size_t max_heap_size = V8HeapTrait::kMaxSize;
+  const double default_factor =
+      V8Controller::GrowingFactor(heap, max_heap_size, 300, 1);
+  heap->SetGarbageCollectionProfile(GarbageCollectionProfile::kThroughput);
+  EXPECT_LT(default_factor,
+            V8Controller::GrowingFactor(heap, max_heap_size, 300, 1));
+  heap->SetGarbageCollectionProfile(GarbageCollectionProfile::kDefault);
+}
+
 TEST_F(MemoryControllerTest, OldGenerationAllocationLimit) {
   Heap* heap = i_isolate()->heap();
   size_t old_gen_size = 128 * MB;
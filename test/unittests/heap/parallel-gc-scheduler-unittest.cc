@@ -0,0 +1,61 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/parallel-gc-scheduler.h"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(ParallelGCSchedulerTest, SingleJobIsNotLimited) {
+  ParallelGCScheduler scheduler(16);
+  ParallelGCScheduler::Scope scope(&scheduler, 10);
+  EXPECT_EQ(1u, scheduler.active_jobs());
+  EXPECT_EQ(16u, scope.MaxConcurrency(100));
+  EXPECT_EQ(3u, scope.MaxConcurrency(3));
+  EXPECT_EQ(0u, scope.MaxConcurrency(0));
+}
+
+TEST(ParallelGCSchedulerTest, SharesAreProportionalToPauseCost) {
+  ParallelGCScheduler scheduler(16);
+  ParallelGCScheduler::Scope expensive(&scheduler, 300);
+  ParallelGCScheduler::Scope cheap(&scheduler, 100);
+  EXPECT_EQ(12u, expensive.MaxConcurrency(100));
+  EXPECT_EQ(4u, cheap.MaxConcurrency(100));
+  // Jobs that need fewer workers than their share don't get more.
+  EXPECT_EQ(2u, expensive.MaxConcurrency(2));
+}
+
+TEST(ParallelGCSchedulerTest, EveryJobGetsAThread) {
+  ParallelGCScheduler scheduler(4);
+  ParallelGCScheduler::Scope expensive(&scheduler, 1000000);
+  std::optional<ParallelGCScheduler::Scope> cheap;
+  cheap.emplace(&scheduler, 1);
+  EXPECT_EQ(4u, expensive.MaxConcurrency(100));
+  EXPECT_EQ(1u, cheap->MaxConcurrency(100));
+  cheap.reset();
+  EXPECT_EQ(1u, scheduler.active_jobs());
+  EXPECT_EQ(4u, expensive.MaxConcurrency(100));
+}
+
+TEST(ParallelGCSchedulerTest, ManyJobs) {
+  ParallelGCScheduler scheduler(16);
+  std::vector<std::unique_ptr<ParallelGCScheduler::Scope>> scopes;
+  for (int i = 0; i < 32; i++) {
+    scopes.push_back(
+        std::make_unique<ParallelGCScheduler::Scope>(&scheduler, 50));
+  }
+  EXPECT_EQ(32u, scheduler.active_jobs());
+  for (auto& scope : scopes) EXPECT_EQ(1u, scope->MaxConcurrency(8));
+  scopes.resize(4);
+  for (auto& scope : scopes) EXPECT_EQ(4u, scope->MaxConcurrency(8));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,89 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifdef V8_ENABLE_MAGLEV
+
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/logging/counters.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+class MaglevBoundsCheckEliminationTest
+    : public TestWithNativeContextAndCounters {
+ public:
+  void SetUp() override {
+    TestWithNativeContextAndCounters::SetUp();
+    if (!v8_flags.maglev) GTEST_SKIP();
+  }
+
+  int EliminatedChecksAfterMaglev(const char* source) {
+    StatsCounter* counter =
+        i_isolate()->counters()->maglev_bounds_checks_eliminated();
+    int before = counter->Get();
+    RunJS(source);
+    return counter->Get() - before;
+  }
+
+ private:
+  FlagScope<bool> allow_natives_syntax_{&v8_flags.allow_natives_syntax, true};
+  FlagScope<bool> bounds_check_elimination_{
+      &v8_flags.maglev_bounds_check_elimination, true};
+};
+
+TEST_F(MaglevBoundsCheckEliminationTest, RemovesCheckDominatedByLoopCondition) {
+  EXPECT_LT(0, EliminatedChecksAfterMaglev(
+                   "function sum(a) {"
+                   "  let s = 0;"
+                   "  for (let i = 0; i < a.length; i++) s += a[i];"
+                   "  return s;"
+                   "}"
+                   "%PrepareFunctionForOptimization(sum);"
+                   "sum([1, 2, 3]);"
+                   "sum([1, 2, 3]);"
+                   "%OptimizeMaglevOnNextCall(sum);"
+                   "sum([1, 2, 3]);"));
+}
+
+TEST_F(MaglevBoundsCheckEliminationTest, KeepsCheckOfShrinkingArray) {
+  EXPECT_EQ(0, EliminatedChecksAfterMaglev(
+                   "function shrinking(a) {"
+                   "  let s = 0;"
+                   "  for (let i = 0; i < a.length; i++) {"
+                   "    a.pop();"
+                   "    s += a[i] === undefined ? 100 : a[i];"
+                   "  }"
+                   "  return s;"
+                   "}"
+                   "%PrepareFunctionForOptimization(shrinking);"
+                   "shrinking([1, 2, 3]);"
+                   "shrinking([1, 2, 3]);"
+                   "%OptimizeMaglevOnNextCall(shrinking);"
+                   "shrinking([1, 2, 3]);"));
+}
+
+TEST_F(MaglevBoundsCheckEliminationTest, KeepsCheckOfPossiblyNegativeIndex) {
+  EXPECT_EQ(0, EliminatedChecksAfterMaglev(
+                   "function fromStart(a, start) {"
+                   "  let s = 0;"
+                   "  for (let i = start; i < a.length; i++) s += a[i] | 0;"
+                   "  return s;"
+                   "}"
+                   "%PrepareFunctionForOptimization(fromStart);"
+                   "fromStart([1, 2, 3], 0);"
+                   "fromStart([1, 2, 3], 0);"
+                   "%OptimizeMaglevOnNextCall(fromStart);"
+                   "fromStart([1, 2, 3], 0);"));
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_ENABLE_MAGLEV
@@ -5,6 +5,7 @@
 #include "src/objects/value-serializer.h"
 
 #include <algorithm>
+#include <limits>
 #include <string>
 
 #include "include/v8-context.h"
@@ -988,6 +989,49 @@ TEST_F(ValueSerializerTest, RoundTripDictionaryObjectForTransitions) {
       ",{\"\xF0\x9F\x91\x8A\":5,\"\xF0\x9F\x91\x9B\":6}]");
 }
 
+TEST_F(ValueSerializerTest, DecodeObjectKeysForTransitions) {
+  // Create transitions for the keys 'ab' and '\u00c3\u00a9' from the initial
+  // Object map of the deserialization context.
+  Local<Object> expected;
+  {
+    Context::Scope scope(deserialization_context());
+    Local<Script> script =
+        Script::Compile(deserialization_context(),
+                        StringFromUtf8("var o = new Object();"
+                                       "o['\\u00c3\\u00a9'] = 0;"
+                                       "var p = new Object();"
+                                       "p.ab = 0;"
+                                       "p"))
+            .ToLocalChecked();
+    expected =
+        script->Run(deserialization_context()).ToLocalChecked().As<Object>();
+  }
+  auto has_expected_map = [&](Local<Value> value) {
+    return Utils::OpenDirectHandle(*value.As<Object>())->map() ==
+           Utils::OpenDirectHandle(*expected)->map();
+  };
+
+  // ASCII UTF-8 and one-byte keys follow the existing transition.
+  Local<Value> value = DecodeTest({0xFF, 0x09, 0x3F, 0x00, 0x6F, 0x53, 0x02,
+                                   0x61, 0x62, 0x49, 0x02, 0x7B, 0x01});
+  EXPECT_TRUE(has_expected_map(value));
+  ExpectScriptTrue("result.ab === 1");
+  value = DecodeTest(
+      {0xFF, 0x0D, 0x6F, 0x22, 0x02, 0x61, 0x62, 0x49, 0x02, 0x7B, 0x01});
+  EXPECT_TRUE(has_expected_map(value));
+  ExpectScriptTrue("result.ab === 1");
+
+  // The UTF-8 encoding of '\u00e9' has the same bytes as the one-byte string
+  // '\u00c3\u00a9', but must not follow its transition.
+  DecodeTestFutureVersions(
+      {0xFF, 0x09, 0x3F, 0x00, 0x6F, 0x53, 0x02, 0xC3, 0xA9, 0x49, 0x02, 0x7B,
+       0x01},
+      [this](Local<Value> value) {
+        ExpectScriptTrue("Object.keys(result).length === 1");
+        ExpectScriptTrue("result['\\u00e9'] === 1");
+      });
+}
+
 TEST_F(ValueSerializerTest, DecodeDictionaryObjectVersion0) {
   // Empty object.
   Local<Value> value = DecodeTestForVersion0({0x7B, 0x00});
@@ -2083,6 +2127,203 @@ TEST_F(ValueSerializerTestWithArrayBufferTransfer,
   ExpectScriptTrue("new Uint8Array(result.a).toString() === '0,1,128,255'");
 }
 
+class ValueSerializerTestWithArrayBufferBlobs : public ValueSerializerTest {
+ protected:
+  static const size_t kBlobThreshold = 4;
+
+  ValueSerializerTestWithArrayBufferBlobs()
+      : serializer_delegate_(this), deserializer_delegate_(this) {}
+
+  void set_mode(ValueSerializer::ArrayBufferBlobMode mode) { mode_ = mode; }
+  // Runs garbage collections whenever a blob is handed to the delegate.
+  void set_gc_on_blob(bool gc_on_blob) { gc_on_blob_ = gc_on_blob; }
+  // Makes the delegate fail once it has handed out |count| blobs.
+  void set_fail_after_blobs(size_t count) { fail_after_blobs_ = count; }
+  const std::vector<std::shared_ptr<BackingStore>>& blobs() const {
+    return blobs_;
+  }
+
+  void BeforeEncode(ValueSerializer* serializer) override {
+    serializer->SetArrayBufferBlobThreshold(kBlobThreshold, mode_);
+  }
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+
+  ValueDeserializer::Delegate* GetDeserializerDelegate() override {
+    return &deserializer_delegate_;
+  }
+
+ private:
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(ValueSerializerTestWithArrayBufferBlobs* test)
+        : test_(test) {}
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+    Maybe<uint32_t> GetArrayBufferBlobId(
+        Isolate* isolate,
+        std::shared_ptr<BackingStore> backing_store) override {
+      if (test_->gc_on_blob_) {
+        test_->InvokeMinorGC();
+        test_->InvokeMajorGC();
+      }
+      if (test_->blobs_.size() == test_->fail_after_blobs_) {
+        isolate->ThrowError("blob refused");
+        return Nothing<uint32_t>();
+      }
+      test_->blobs_.push_back(std::move(backing_store));
+      return Just(static_cast<uint32_t>(test_->blobs_.size() - 1));
+    }
+
+   private:
+    ValueSerializerTestWithArrayBufferBlobs* test_;
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    explicit DeserializerDelegate(ValueSerializerTestWithArrayBufferBlobs* test)
+        : test_(test) {}
+    std::shared_ptr<BackingStore> GetArrayBufferBlobFromId(
+        Isolate* isolate, uint32_t blob_id) override {
+      CHECK_LT(blob_id, test_->blobs_.size());
+      return test_->blobs_[blob_id];
+    }
+
+   private:
+    ValueSerializerTestWithArrayBufferBlobs* test_;
+  };
+
+  ValueSerializer::ArrayBufferBlobMode mode_ =
+      ValueSerializer::ArrayBufferBlobMode::kCopy;
+  bool gc_on_blob_ = false;
+  size_t fail_after_blobs_ = std::numeric_limits<size_t>::max();
+  std::vector<std::shared_ptr<BackingStore>> blobs_;
+  SerializerDelegate serializer_delegate_;
+  DeserializerDelegate deserializer_delegate_;
+};
+
+TEST_F(ValueSerializerTestWithArrayBufferBlobs, RoundTripCopy) {
+  Local<Value> input = EvaluateScriptForInput(
+      "var small = new Uint8Array([1, 2]).buffer;"
+      "var large = new Uint8Array([0, 1, 128, 255, 7]).buffer;"
+      "({small, large, again: large})");
+  Local<Value> value = RoundTripTest(input);
+  ASSERT_TRUE(value->IsObject());
+  ASSERT_EQ(1u, blobs().size());
+  ExpectScriptTrue("new Uint8Array(result.small).toString() === '1,2'");
+  ExpectScriptTrue(
+      "new Uint8Array(result.large).toString() === '0,1,128,255,7'");
+  ExpectScriptTrue("result.large === result.again");
+  // The source buffer is left untouched, and the result wraps the blob.
+  EXPECT_TRUE(EvaluateScriptForInput("large.byteLength === 5")->IsTrue());
+  Local<Value> large;
+  {
+    Context::Scope scope(deserialization_context());
+    large = value.As<Object>()
+                ->Get(deserialization_context(), StringFromUtf8("large"))
+                .ToLocalChecked();
+  }
+  EXPECT_EQ(blobs()[0]->Data(), large.As<ArrayBuffer>()->Data());
+}
+
+TEST_F(ValueSerializerTestWithArrayBufferBlobs, RoundTripMove) {
+  set_mode(ValueSerializer::ArrayBufferBlobMode::kMove);
+  Local<Value> input = EvaluateScriptForInput(
+      "var buffer = new Uint8Array([0, 1, 128, 255, 7, 8]).buffer;"
+      "[new Uint8Array(buffer, 2, 3), new DataView(buffer)]");
+  void* data = EvaluateScriptForInput("buffer").As<ArrayBuffer>()->Data();
+  RoundTripTest(input);
+  ASSERT_EQ(1u, blobs().size());
+  EXPECT_EQ(data, blobs()[0]->Data());
+  EXPECT_TRUE(EvaluateScriptForInput("buffer.detached")->IsTrue());
+  ExpectScriptTrue("result[0].toString() === '128,255,7'");
+  ExpectScriptTrue("result[0].buffer === result[1].buffer");
+  ExpectScriptTrue("result[1].byteLength === 6");
+  ExpectScriptTrue("result[1].getUint8(5) === 8");
+}
+
+TEST_F(ValueSerializerTestWithArrayBufferBlobs, MoveFailureDoesNotDetach) {
+  set_mode(ValueSerializer::ArrayBufferBlobMode::kMove);
+  InvalidEncodeTest(
+      "var buffer = new ArrayBuffer(16);"
+      "[buffer, Symbol()]");
+  EXPECT_TRUE(EvaluateScriptForInput("buffer.detached")->IsFalse());
+  // The backing store is not handed out either.
+  EXPECT_EQ(0u, blobs().size());
+}
+
+TEST_F(ValueSerializerTestWithArrayBufferBlobs, MoveBufferTransferredByGetter) {
+  set_mode(ValueSerializer::ArrayBufferBlobMode::kMove);
+  // The buffer is queued when it is written, and transferred by a getter which
+  // runs before the backing stores are handed out.
+  Local<Message> message = InvalidEncodeTest(
+      "var buffer = new ArrayBuffer(16);"
+      "var transferred;"
+      "({a: buffer, get b() { transferred = buffer.transfer(); }})");
+  ASSERT_FALSE(message.IsEmpty());
+  EXPECT_NE(std::string::npos,
+            Utf8Value(message->Get()).find("ArrayBuffer is detached"));
+  EXPECT_EQ(0u, blobs().size());
+  EXPECT_TRUE(
+      EvaluateScriptForInput("transferred.byteLength === 16")->IsTrue());
+}
+
+TEST_F(ValueSerializerTestWithArrayBufferBlobs, MoveDelegateFailureDetaches) {
+  set_mode(ValueSerializer::ArrayBufferBlobMode::kMove);
+  set_fail_after_blobs(1);
+  InvalidEncodeTest(
+      "var first = new ArrayBuffer(16);"
+      "var second = new ArrayBuffer(16);"
+      "[first, second]");
+  // The delegate keeps the first backing store, so the first buffer must not
+  // stay usable. The second one was never handed out.
+  ASSERT_EQ(1u, blobs().size());
+  EXPECT_TRUE(EvaluateScriptForInput("first.detached")->IsTrue());
+  EXPECT_TRUE(EvaluateScriptForInput("second.detached")->IsFalse());
+}
+
+TEST_F(ValueSerializerTestWithArrayBufferBlobs, MoveNestedBuffersSurvivesGC) {
+  set_mode(ValueSerializer::ArrayBufferBlobMode::kMove);
+  set_gc_on_blob(true);
+  // The buffers are reached only through nested objects, whose handles are
+  // gone by the time the blobs are handed out.
+  Local<Value> input = EvaluateScriptForInput(
+      "var plain = new Uint8Array([1, 2, 3, 4, 5]).buffer;"
+      "var viewed = new Uint8Array([6, 7, 8, 9, 10, 11]).buffer;"
+      "({a: {b: plain}, c: {d: new Uint8Array(viewed, 1)}})");
+  void* plain_data = EvaluateScriptForInput("plain").As<ArrayBuffer>()->Data();
+  void* viewed_data =
+      EvaluateScriptForInput("viewed").As<ArrayBuffer>()->Data();
+  RoundTripTest(input);
+  ASSERT_EQ(2u, blobs().size());
+  EXPECT_EQ(plain_data, blobs()[0]->Data());
+  EXPECT_EQ(viewed_data, blobs()[1]->Data());
+  EXPECT_TRUE(EvaluateScriptForInput("plain.detached")->IsTrue());
+  EXPECT_TRUE(EvaluateScriptForInput("viewed.detached")->IsTrue());
+  ExpectScriptTrue("new Uint8Array(result.a.b).toString() === '1,2,3,4,5'");
+  ExpectScriptTrue("result.c.d.toString() === '7,8,9,10,11'");
+  ExpectScriptTrue("result.c.d.buffer.byteLength === 6");
+}
+
+TEST_F(ValueSerializerTestWithArrayBufferBlobs, ResizableBufferIsInline) {
+  set_mode(ValueSerializer::ArrayBufferBlobMode::kMove);
+  RoundTripTest("new ArrayBuffer(8, {maxByteLength: 16})");
+  EXPECT_EQ(0u, blobs().size());
+  ExpectScriptTrue("result.resizable && result.byteLength === 8");
+}
+
+TEST_F(ValueSerializerTestWithArrayBufferBlobs, DecodeInvalidBlob) {
+  std::vector<uint8_t> data = EncodeTest("new ArrayBuffer(8)");
+  ASSERT_EQ(1u, blobs().size());
+  // The byte length recorded in the data must match the backing store.
+  ASSERT_EQ(8, data.back());
+  data.back() = 9;
+  InvalidDecodeTest(data);
+}
+
 TEST_F(ValueSerializerTest, RoundTripTypedArray) {
   FLAG_SCOPE(js_float16array);
   // Check that the right type comes out the other side for every kind of typed
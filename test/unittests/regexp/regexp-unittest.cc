@@ -19,6 +19,7 @@
 #include "src/init/v8.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -2331,6 +2332,73 @@ TEST_F(RegExpTestWithContext, UnicodePropertyEscapeCodeSize) {
   }
 }
 
+TEST_F(RegExpTest, SharedBytecodeCacheLimit) {
+  FlagScope<unsigned int> f(&v8_flags.regexp_shared_bytecode_cache_size_kb, 1);
+  RegExpBytecodeCache cache;
+  const uint8_t pattern[] = {'a', 'b'};
+  RegExpBytecodeCache::Key key = RegExpBytecodeCache::MakeKey(
+      base::VectorOf(pattern, 2), RegExpFlag::kGlobal, true,
+      JSRegExp::kNoBacktrackLimit);
+
+  RegExpBytecodeCache::Entry entry;
+  CHECK(!cache.Lookup(key, &entry));
+  entry.bytecode = {1, 2, 3};
+  entry.register_count = 4;
+  entry.backtrack_limit = JSRegExp::kNoBacktrackLimit;
+  entry.named_captures.push_back({{'x'}, 1});
+  cache.Insert(key, entry);
+  CHECK_LT(size_t{0}, cache.size_in_bytes());
+
+  RegExpBytecodeCache::Entry found;
+  CHECK(cache.Lookup(key, &found));
+  CHECK_EQ(entry.bytecode, found.bytecode);
+  CHECK_EQ(4, found.register_count);
+  CHECK_EQ(1, found.named_captures[0].index);
+
+  // The same pattern with other flags is a different entry.
+  RegExpBytecodeCache::Key sticky_key = RegExpBytecodeCache::MakeKey(
+      base::VectorOf(pattern, 2), RegExpFlag::kSticky, true,
+      JSRegExp::kNoBacktrackLimit);
+  CHECK(!cache.Lookup(sticky_key, &found));
+
+  // Entries that don't fit are dropped.
+  const size_t size = cache.size_in_bytes();
+  entry.bytecode.resize(KB);
+  cache.Insert(sticky_key, entry);
+  CHECK(!cache.Lookup(sticky_key, &found));
+  CHECK_EQ(size, cache.size_in_bytes());
+
+  cache.Clear();
+  CHECK(!cache.Lookup(key, &found));
+  CHECK_EQ(size_t{0}, cache.size_in_bytes());
+}
+
+// Regexps compiled to bytecode are installed from the process-wide cache
+// when the per-isolate compilation cache doesn't know them.
+TEST_F(RegExpTestWithContext, SharedBytecodeCache) {
+  FlagScope<bool> f(&v8_flags.regexp_interpret_all, true);
+  RegExpBytecodeCache* cache = GetProcessWideRegExpBytecodeCache();
+  cache->Clear();
+
+  v8::HandleScope scope(isolate());
+  const char* kScript =
+      "const r = /(?<year>\\d{4})-(?<month>\\d{2})/;"
+      "r.exec('on 2024-05-17').groups.month;";
+  CHECK_EQ(size_t{0}, cache->size_in_bytes());
+  CHECK(RunJS(kScript)->StrictEquals(NewString("05")));
+  const size_t size = cache->size_in_bytes();
+  CHECK_LT(size_t{0}, size);
+
+  // A fresh context creates a new JSRegExp, which has to compile again.
+  i_isolate()->compilation_cache()->Clear();
+  v8::Local<v8::Context> other_context = v8::Context::New(isolate());
+  CHECK(RunJS(other_context, kScript)->StrictEquals(NewString("05")));
+  CHECK(RunJS(other_context, "r.exec('1999-12').groups.year")
+            ->StrictEquals(NewString("1999")));
+  CHECK_EQ(size, cache->size_in_bytes());
+  cache->Clear();
+}
+
 namespace {
 
 struct RegExpExecData {
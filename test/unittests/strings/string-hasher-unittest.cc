@@ -0,0 +1,84 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "src/objects/name-inl.h"
+#include "src/strings/string-hasher-inl.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr uint64_t kSeed = 0x1234'5678'9abc'def0;
+
+uint32_t HashOneByte(const std::string& s) {
+  return StringHasher::HashSequentialString(s.data(),
+                                            static_cast<int>(s.size()), kSeed);
+}
+
+uint32_t HashTwoByte(const std::string& s) {
+  std::vector<uint16_t> chars(s.begin(), s.end());
+  return StringHasher::HashSequentialString(
+      chars.data(), static_cast<int>(chars.size()), kSeed);
+}
+
+}  // namespace
+
+TEST(StringHasherTest, OneByteAndTwoByteAgree) {
+  // Cover every tail length around the block sizes of the wide hash.
+  std::string s;
+  for (int length = 0; length < 100; length++) {
+    EXPECT_EQ(HashOneByte(s), HashTwoByte(s)) << "length " << length;
+    s.push_back(static_cast<char>('a' + length % 26));
+  }
+}
+
+TEST(StringHasherTest, HashIsNonZero) {
+  for (int length = 1; length < 100; length++) {
+    std::string s(length, 'x');
+    uint32_t raw_hash = HashOneByte(s);
+    EXPECT_TRUE(Name::IsHash(raw_hash));
+    EXPECT_NE(0u, Name::HashBits::decode(raw_hash));
+  }
+}
+
+TEST(StringHasherTest, EveryCharacterContributes) {
+  for (int length = 1; length < 100; length++) {
+    std::string s(length, 'x');
+    uint32_t hash = HashOneByte(s);
+    for (int i = 0; i < length; i++) {
+      std::string t = s;
+      t[i] = 'y';
+      EXPECT_NE(hash, HashOneByte(t)) << "length " << length << " at " << i;
+    }
+  }
+}
+
+TEST(StringHasherTest, LongTwoByteCharacters) {
+  std::vector<uint16_t> a(64, 0x20ac);
+  std::vector<uint16_t> b(64, 0x20ac);
+  b[63] = 0x20ad;
+  EXPECT_NE(StringHasher::HashSequentialString(a.data(), 64, kSeed),
+            StringHasher::HashSequentialString(b.data(), 64, kSeed));
+}
+
+TEST(StringHasherTest, Indices) {
+  uint32_t raw_hash = HashOneByte("4294967294");
+  EXPECT_TRUE(Name::ContainsCachedArrayIndex(raw_hash) ||
+              Name::IsIntegerIndex(raw_hash));
+  EXPECT_EQ(raw_hash, HashTwoByte("4294967294"));
+  EXPECT_EQ(StringHasher::MakeArrayIndexHash(123, 3), HashOneByte("123"));
+#if V8_HOST_ARCH_64_BIT
+  EXPECT_TRUE(Name::IsIntegerIndex(HashOneByte("9007199254740991")));
+#endif
+  EXPECT_TRUE(Name::IsHash(HashOneByte("01")));
+  EXPECT_TRUE(Name::IsHash(HashOneByte("12345678901234567890123456789012")));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -205,6 +205,27 @@ class ZoneVectorTest : public TestWithZone {
     live_set<T>().CheckEmpty();
   }
 
+  template <class T>
+  void MoveAssignFromOtherZone() {
+    {
+      Zone other_zone(zone()->allocator(), ZONE_NAME);
+      ZoneVector<T> v({T(1), T(2)}, zone());
+      // Move assignment takes over the zone of the moved vector, and later
+      // growth happens in that zone.
+      v = ZoneVector<T>({T(3)}, &other_zone);
+      CHECK_EQ(&other_zone, v.zone());
+      CheckConsistency(v, {3});
+      size_t other_zone_size = other_zone.allocation_size();
+      size_t zone_size = zone()->allocation_size();
+      v.emplace_back(4);
+      v.emplace_back(5);
+      CheckConsistency(v, {3, 4, 5});
+      CHECK_LT(other_zone_size, other_zone.allocation_size());
+      CHECK_EQ(zone_size, zone()->allocation_size());
+    }
+    live_set<T>().CheckEmpty();
+  }
+
   template <class T>
   void Assign() {
     {
@@ -349,6 +370,13 @@ TEST_F(ZoneVectorTest, Basic) {
   Basic<NotAssignable>();
 }
 
+TEST_F(ZoneVectorTest, MoveAssignFromOtherZone) {
+  MoveAssignFromOtherZone<Trivial>();
+  MoveAssignFromOtherZone<CopyAssignable>();
+  MoveAssignFromOtherZone<MoveAssignable>();
+  MoveAssignFromOtherZone<NotAssignable>();
+}
+
 TEST_F(ZoneVectorTest, Assign) {
   Assign<Trivial>();
   Assign<CopyAssignable>();